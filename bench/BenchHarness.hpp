@@ -0,0 +1,143 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+
+// ============================================================================
+// 极简基准测试框架 (无第三方依赖，无窗口)
+// 用法：
+//   RINN_BENCH(my_case) {
+//       ctx.measure("what", ops, [&] { ... });
+//   }
+// measure 把 fn 重复执行若干次 (默认 5 次，rinn_bench --repeat N 可改)，报告 ns/op 的中位数与最小值
+// fn 会改变状态、不能重复执行时 (首次创建 / 销毁 / clear 等) 用 measure_once
+// 同时记录 ops/sec (按中位数) 与单次执行的最大堆分配次数 / 字节数 (main.cpp 替换了全局 operator new)
+// 结果同时收集到 results()，main 可按 --json 写出，便于在提交之间做 diff
+// ============================================================================
+namespace Rinn::Bench {
+
+    using Clock = std::chrono::steady_clock;
+
+    // 全局分配计数 (由 main.cpp 的 operator new 递增)
+    struct AllocCounters {
+        std::atomic<size_t> count{ 0 };
+        std::atomic<size_t> bytes{ 0 };
+    };
+
+    inline AllocCounters& allocations() {
+        static AllocCounters counters;
+        return counters;
+    }
+
+    struct Result {
+        std::string case_name;
+        std::string label;
+        size_t ops;
+        double ns_per_op;           // 各次执行的中位数
+        double min_ns_per_op;
+        double ops_per_sec;
+        size_t allocs;              // 单次执行的最大值
+        size_t alloc_bytes;
+        size_t repetitions;
+    };
+
+    inline std::vector<Result>& results() {
+        static std::vector<Result> recorded;
+        return recorded;
+    }
+
+    // 阻止编译器把被测结果当成死代码消除
+    template<typename T>
+    inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    class Context {
+    public:
+        static constexpr size_t DEFAULT_REPETITIONS = 5;
+
+        explicit Context(std::string_view case_name, size_t repetitions = DEFAULT_REPETITIONS)
+            : case_name(case_name), repetitions(repetitions ? repetitions : 1) {}
+
+        // 重复执行 fn，fn 每次内部完成 ops 次操作；fn 必须可以重复执行 (执行后状态与执行前等价)
+        // 打印 ns/op 中位数与最小值、ops/sec 与分配次数，返回中位数
+        template<typename Fn>
+        double measure(std::string_view label, size_t ops, Fn&& fn) {
+            return run(label, ops, repetitions, fn);
+        }
+
+        // 只执行一次：fn 会消耗状态 (首次创建、销毁、clear 等)
+        template<typename Fn>
+        double measure_once(std::string_view label, size_t ops, Fn&& fn) {
+            return run(label, ops, 1, fn);
+        }
+
+    private:
+        std::string_view case_name;
+        size_t repetitions;
+        std::vector<double> samples;        // 各次执行的 ns/op (复用，不计入被测分配)
+
+        template<typename Fn>
+        double run(std::string_view label, size_t ops, size_t count, Fn& fn) {
+            samples.reserve(count);
+            samples.clear();
+            size_t allocs = 0;
+            size_t alloc_bytes = 0;
+            for (size_t rep = 0; rep < count; ++rep) {
+                const size_t allocs_before = allocations().count.load(std::memory_order_relaxed);
+                const size_t bytes_before = allocations().bytes.load(std::memory_order_relaxed);
+                const auto start = Clock::now();
+                fn();
+                const auto stop = Clock::now();
+                allocs = std::max(allocs, allocations().count.load(std::memory_order_relaxed) - allocs_before);
+                alloc_bytes = std::max(alloc_bytes, allocations().bytes.load(std::memory_order_relaxed) - bytes_before);
+
+                const double ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+                samples.push_back(ops ? ns / static_cast<double>(ops) : ns);
+            }
+
+            std::sort(samples.begin(), samples.end());
+            const size_t mid = samples.size() / 2;
+            const double median = samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2.0;
+            const double ops_per_sec = median > 0.0 ? 1e9 / median : 0.0;
+            std::printf("  %-28.*s %-36.*s %12.2f ns/op %10.2f min %14.0f ops/s %10zu allocs  x%zu\n",
+                static_cast<int>(case_name.size()), case_name.data(),
+                static_cast<int>(label.size()), label.data(),
+                median, samples.front(), ops_per_sec, allocs, count);
+
+            results().push_back({ std::string(case_name), std::string(label), ops, median, samples.front(), ops_per_sec, allocs, alloc_bytes, count });
+            return median;
+        }
+    };
+
+    struct Case {
+        const char* name;
+        void (*fn)(Context&);
+    };
+
+    inline std::vector<Case>& cases() {
+        static std::vector<Case> registered;
+        return registered;
+    }
+
+    inline bool register_case(const char* name, void (*fn)(Context&)) {
+        cases().push_back({ name, fn });
+        return true;
+    }
+}
+
+// 定义并自动注册一个基准用例
+#define RINN_BENCH(case_name)                                                            \
+    static void case_name(Rinn::Bench::Context& ctx);                                    \
+    static const bool case_name##_registered = Rinn::Bench::register_case(#case_name, &case_name); \
+    static void case_name([[maybe_unused]] Rinn::Bench::Context& ctx)
@@ -0,0 +1,154 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Core/ArchetypeRegistry.hpp"
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// 稀疏集 (BasicRegistry) 与 Archetype (BasicArchetypeRegistry) 两种后端对照
+// 同一份工作负载分别跑两遍，按负载特征选后端：
+//   - 创建 / 挂组件 (结构变化)
+//   - 全匹配的双组件遍历
+//   - 碎片化查询：最小池里大部分实体不匹配 (稀疏集 View 的最坏情况)
+//   - 反复添加 / 移除一个组件 (Archetype 的最坏情况：整行搬家)
+//   - 随机 get
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t ENTITY_COUNT = 200'000;
+    constexpr size_t FRAMES = 10;
+
+    // 行式本地组件，两种后端都能在 View 中可写访问
+    struct Position { float x, y; };
+    struct Motion { float vx, vy; };
+    struct Health { int value; };
+    struct Poisoned { int ticks; };
+
+    using SparseWorld = BasicRegistry<WideEntityTraits>;
+    using ArchetypeWorld = BasicArchetypeRegistry<WideEntityTraits>;
+
+    std::string label(const char* backend, const char* what) {
+        return std::string(backend) + ": " + what;
+    }
+
+    // 全部实体挂 Position + Motion + Health
+    template<typename Reg>
+    std::vector<typename Reg::Entity> populate(Reg& reg) {
+        std::vector<typename Reg::Entity> entities = reg.create_entities(ENTITY_COUNT);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const float f = static_cast<float>(i);
+            (void)reg.template emplace<Position>(entities[i], f, f);
+            (void)reg.template emplace<Motion>(entities[i], 1.0f, 0.5f);
+            (void)reg.template emplace<Health>(entities[i], 100);
+        }
+        return entities;
+    }
+
+    template<typename Reg>
+    void structural(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        std::vector<typename Reg::Entity> entities;
+        ctx.measure_once(label(backend, "create + emplace x3"), ENTITY_COUNT, [&] {
+            entities = populate(*reg);
+        });
+        ctx.measure_once(label(backend, "destroy_entity"), ENTITY_COUNT, [&] {
+            reg->destroy_entities(entities);
+        });
+        Bench::do_not_optimize(reg->size());
+    }
+
+    template<typename Reg>
+    void iterate(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        (void)populate(*reg);
+        ctx.measure(label(backend, "view<Position, const Motion>"), ENTITY_COUNT * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                reg->template view<Position, const Motion>().each([](typename Reg::Entity, Position& p, const Motion& m) {
+                    p.x += m.vx;
+                    p.y += m.vy;
+                });
+            }
+        });
+    }
+
+    // Position 与 Health 各约 100k，只有 10k 重叠：稀疏集从最小池出发逐个检查签名，Archetype 只访问匹配的块
+    template<typename Reg>
+    void fragmented(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        const std::vector<typename Reg::Entity> entities = reg->create_entities(ENTITY_COUNT);
+        const size_t half = ENTITY_COUNT / 2;
+        const size_t overlap = half / 10;
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (i < half + overlap) (void)reg->template emplace<Position>(entities[i], 0.0f, 0.0f);
+            if (i >= half) (void)reg->template emplace<Health>(entities[i], 100);
+        }
+
+        size_t hits = 0;
+        ctx.measure(label(backend, "fragmented view (10% overlap)"), half * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                reg->template view<const Position, Health>().each([&hits](typename Reg::Entity, const Position&, Health& h) {
+                    ++h.value;
+                    ++hits;
+                });
+            }
+        });
+        Bench::do_not_optimize(hits);
+    }
+
+    // 每帧给 10% 的实体加上 Poisoned，下一帧再移除
+    template<typename Reg>
+    void churn(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        const std::vector<typename Reg::Entity> entities = populate(*reg);
+        const size_t count = ENTITY_COUNT / 10;
+        ctx.measure(label(backend, "add + remove component"), count * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                for (size_t i = 0; i < count; ++i) (void)reg->template emplace<Poisoned>(entities[i * 10], 3);
+                for (size_t i = 0; i < count; ++i) reg->template remove<Poisoned>(entities[i * 10]);
+            }
+        });
+    }
+
+    template<typename Reg>
+    void random_get(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        const std::vector<typename Reg::Entity> entities = populate(*reg);
+        std::vector<typename Reg::Entity> order = entities;
+        std::shuffle(order.begin(), order.end(), std::mt19937(11));
+
+        float sum = 0.0f;
+        ctx.measure(label(backend, "random get<Position>"), ENTITY_COUNT, [&] {
+            for (const auto e : order) sum += std::as_const(*reg).template get<Position>(e).x;
+        });
+        Bench::do_not_optimize(sum);
+    }
+}
+
+RINN_BENCH(backend_structural) {
+    structural<SparseWorld>(ctx, "sparse");
+    structural<ArchetypeWorld>(ctx, "archetype");
+}
+
+RINN_BENCH(backend_iterate) {
+    iterate<SparseWorld>(ctx, "sparse");
+    iterate<ArchetypeWorld>(ctx, "archetype");
+}
+
+RINN_BENCH(backend_fragmented) {
+    fragmented<SparseWorld>(ctx, "sparse");
+    fragmented<ArchetypeWorld>(ctx, "archetype");
+}
+
+RINN_BENCH(backend_churn) {
+    churn<SparseWorld>(ctx, "sparse");
+    churn<ArchetypeWorld>(ctx, "archetype");
+}
+
+RINN_BENCH(backend_random_get) {
+    random_get<SparseWorld>(ctx, "sparse");
+    random_get<ArchetypeWorld>(ctx, "archetype");
+}
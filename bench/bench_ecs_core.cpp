@@ -0,0 +1,377 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "components/Components.hpp"
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// ECS 核心操作的单项开销 (默认配置：32 位句柄，16384 实体，全部内联)
+// - EntityPool::acquire / release
+// - Registry::emplace / remove / destroy_entity
+// - View 遍历：最小池中匹配比例 1% / 10% / 50% / 100%
+// - Registry::clear
+// - Registry::compact：大批销毁后收缩组件池
+// - 标记组件：每帧 3 种标记各翻转一遍 (约 5 万次挂 / 摘)，TagSet 对比带 1 字节数据的普通组件
+// - View::each 对比手写逐候选循环：命中率 1% / 10% / 50%
+// - 查询项：exclude / optional 的低匹配率查询，签名一次比较对比逐实体 has<> 检查
+// - 持久查询：每帧少量挂 / 摘标记后遍历，增量维护的匹配表对比每帧重新过滤的 View
+// - 生命周期信号：无监听 / 即时 / 批量监听时 emplace + remove 的开销；每帧 1% 新增组件时信号对比轮询 added_since
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t CAPACITY = DefaultEntityTraits::MAX_ENTITIES;
+    constexpr size_t ROUNDS = 64;       // 容量只有 16K，多轮重复拉长计时
+
+    // 行式本地组件，View 中可写
+    struct Position { float x, y; };
+    struct Health { int value; };
+
+    // 空类型自动走 TagSet；对照组带 1 字节数据，走 SparseSet
+    struct Selected {};
+    struct Burning {};
+    struct IsStatic {};
+    template<int N> struct Flag { bool value = true; };
+}
+
+RINN_BENCH(entity_pool) {
+    auto pool = std::make_unique<EntityPool>();
+    std::vector<Entity> entities(CAPACITY);
+
+    ctx.measure_once("acquire (fresh)", CAPACITY, [&] {
+        for (Entity& e : entities) e = pool->acquire();
+    });
+    ctx.measure_once("release", CAPACITY, [&] {
+        for (Entity e : entities) pool->release(e.index());
+    });
+    ctx.measure("acquire + release (recycled)", CAPACITY * ROUNDS, [&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (Entity& e : entities) e = pool->acquire();
+            for (Entity e : entities) pool->release(e.index());
+        }
+    });
+    Bench::do_not_optimize(pool->size());
+}
+
+RINN_BENCH(registry_ops) {
+    auto reg = std::make_unique<Registry>();
+    std::vector<Entity> entities(CAPACITY);
+    reg->create_entities(std::span<Entity>(entities));
+
+    ctx.measure_once("emplace<Position>", CAPACITY, [&] {
+        for (Entity e : entities) (void)reg->emplace<Position>(e, 1.0f, 2.0f);
+    });
+    ctx.measure_once("emplace<Sprite>", CAPACITY, [&] {
+        for (Entity e : entities) (void)reg->emplace<Sprite>(e, Sprite{ 1, 16.0f, 16.0f });
+    });
+    ctx.measure_once("emplace<Transform> (columns)", CAPACITY, [&] {
+        for (Entity e : entities) (void)reg->emplace<Transform>(e, 1.0f, 2.0f);
+    });
+    ctx.measure_once("remove<Position>", CAPACITY, [&] {
+        for (Entity e : entities) reg->remove<Position>(e);
+    });
+    ctx.measure("emplace + remove<Position>", CAPACITY * ROUNDS, [&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (Entity e : entities) (void)reg->emplace<Position>(e, 1.0f, 2.0f);
+            for (Entity e : entities) reg->remove<Position>(e);
+        }
+    });
+    ctx.measure_once("destroy_entity (2 components)", CAPACITY, [&] {
+        for (Entity e : entities) reg->destroy_entity(e);
+    });
+    Bench::do_not_optimize(reg->size());
+}
+
+// 两个池一样大，最小池里只有 ratio 比例的实体同时拥有两种组件
+RINN_BENCH(view_match_ratio) {
+    for (const size_t percent : { 1, 10, 50, 100 }) {
+        auto reg = std::make_unique<Registry>();
+        const size_t half = CAPACITY / 2;
+        const size_t overlap = half * percent / 100;
+        std::vector<Entity> entities(half * 2 - overlap);
+        reg->create_entities(std::span<Entity>(entities));
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (i < half) (void)reg->emplace<Position>(entities[i], 0.0f, 0.0f);
+            if (i >= half - overlap) (void)reg->emplace<Health>(entities[i], 100);
+        }
+
+        const std::string label = "view<Position, Health> " + std::to_string(percent) + "% match";
+        size_t hits = 0;
+        ctx.measure(label, half * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                reg->view<Position, Health>().each([&hits](Entity, Position& p, Health& h) {
+                    p.x += 1.0f;
+                    ++h.value;
+                    ++hits;
+                });
+            }
+        });
+        Bench::do_not_optimize(hits);
+    }
+}
+
+// View::each 的过滤开销：同一个 view<Position, Health>，Health 按 percent% 打散在最小池里
+// 对照组是手写的逐候选循环 (读签名、分支判断、直接取池)，View::each 不应比它慢
+RINN_BENCH(view_prefilter) {
+    for (const size_t percent : { 1, 10, 50 }) {
+        // 前一半实体有 Position (最小池，即候选)，其中 percent% 有 Health；后一半只有 Health，保证 Health 池更大
+        auto reg = std::make_unique<Registry>();
+        std::vector<Entity> all(CAPACITY);
+        reg->create_entities(std::span<Entity>(all));
+        const std::span<const Entity> entities(all.data(), CAPACITY / 2);
+        for (size_t i = 0; i < all.size(); ++i) {
+            const bool candidate = i < entities.size();
+            if (candidate) (void)reg->emplace<Position>(all[i], 0.0f, 0.0f);
+            if (!candidate || (i * 0x9E3779B97F4A7C15ull >> 40) % 100 < percent) (void)reg->emplace<Health>(all[i], 100);     // 高位取模，没有短周期
+        }
+
+        const auto work = [](Entity, Position& p, Health& h) { p.x += static_cast<float>(h.value); };
+        const std::string suffix = " " + std::to_string(percent) + "% match";
+
+        auto& positions = reg->storage<Position>();
+        auto& healths = reg->storage<Health>();
+        Signature required;
+        required.set(get_component_type_id<Position>());
+        required.set(get_component_type_id<Health>());
+        ctx.measure("per-entity check" + suffix, entities.size() * ROUNDS, [&] {
+            const Registry& view_of = *reg;
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                const Entity* candidates = positions.entity_data();
+                for (size_t i = 0, n = positions.size(); i < n; ++i) {
+                    const Entity e = candidates[i];
+                    if ((view_of.signature(e) & required) == required) work(e, positions.get(e), healths.get(e));
+                }
+            }
+        });
+
+        ctx.measure("View::each" + suffix, entities.size() * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                reg->view<Position, Health>().each(work);
+            }
+        });
+    }
+}
+
+RINN_BENCH(registry_clear) {
+    auto reg = std::make_unique<Registry>();
+    std::vector<Entity> entities(CAPACITY);
+    reg->create_entities(std::span<Entity>(entities));
+    for (Entity e : entities) {
+        (void)reg->emplace<Position>(e, 0.0f, 0.0f);
+        (void)reg->emplace<Health>(e, 100);
+    }
+    ctx.measure_once("clear (16K entities, 2 components)", CAPACITY, [&] {
+        reg->clear();
+    });
+    Bench::do_not_optimize(reg->size());
+}
+
+// 挂满后销毁 90%，对比收缩前后的常驻内存
+RINN_BENCH(registry_compact) {
+    auto reg = std::make_unique<Registry>();
+    std::vector<Entity> entities(CAPACITY);
+    reg->create_entities(std::span<Entity>(entities));
+    for (Entity e : entities) {
+        (void)reg->emplace<Position>(e, 0.0f, 0.0f);
+        (void)reg->emplace<Health>(e, 100);
+    }
+    const size_t survivors = CAPACITY / 10;
+    reg->destroy_entities(std::span<const Entity>(entities).subspan(survivors));
+
+    const size_t before = reg->memory_stats().pool_bytes();
+    size_t freed = 0;
+    ctx.measure_once("compact (default policy, 90% despawned)", CAPACITY, [&] {
+        freed = reg->compact();
+    });
+    std::printf("  %-28s pools %zu KB -> %zu KB (freed %zu KB)\n", "", before / 1024, reg->memory_stats().pool_bytes() / 1024, freed / 1024);
+}
+
+// 每帧：每个实体的 3 种标记中翻转一种 (有则摘、无则挂)，然后遍历一次带标记的实体
+RINN_BENCH(tag_toggle) {
+    constexpr size_t FRAMES = 30;
+    const auto run = [&ctx](const char* label, auto tags) {
+        using A = std::tuple_element_t<0, decltype(tags)>;
+        using B = std::tuple_element_t<1, decltype(tags)>;
+        using C = std::tuple_element_t<2, decltype(tags)>;
+
+        auto reg = std::make_unique<Registry>();
+        std::vector<Entity> entities(CAPACITY);
+        reg->create_entities(std::span<Entity>(entities));
+        for (Entity e : entities) (void)reg->emplace<Position>(e, 0.0f, 0.0f);
+
+        const auto toggle = [&reg]<typename T>(Entity e) {
+            if (reg->has<T>(e)) reg->remove<T>(e);
+            else (void)reg->emplace<T>(e);
+        };
+        size_t hits = 0;
+        ctx.measure(label, CAPACITY * 3 * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                for (size_t i = 0; i < entities.size(); ++i) {
+                    toggle.template operator()<A>(entities[i]);
+                    if ((i + frame) % 2 == 0) toggle.template operator()<B>(entities[i]);
+                    else toggle.template operator()<C>(entities[i]);
+                    toggle.template operator()<A>(entities[i]);
+                    toggle.template operator()<A>(entities[i]);
+                }
+                reg->view<const Position, const A>().each([&hits](Entity, const Position&, const A&) { ++hits; });
+            }
+        });
+        Bench::do_not_optimize(hits);
+        std::printf("  %-28s tag pools %zu bytes\n", "", reg->memory_stats().pool_bytes());
+    };
+
+    run("toggle tag (TagSet)", std::tuple<Selected, Burning, IsStatic>{});
+    run("toggle 1-byte flag (SparseSet)", std::tuple<Flag<0>, Flag<1>, Flag<2>>{});
+}
+
+// AI 式的低匹配率查询：人人有 Position / Health，只有 percent% 没在燃烧 (散布在池中)，其中一半被选中
+RINN_BENCH(query_exclude_optional) {
+    for (const size_t percent : { 1, 10, 50, 100 }) {
+        auto reg = std::make_unique<Registry>();
+        std::vector<Entity> entities(CAPACITY);
+        reg->create_entities(std::span<Entity>(entities));
+        for (size_t i = 0; i < entities.size(); ++i) {
+            (void)reg->emplace<Position>(entities[i], 0.0f, 0.0f);
+            (void)reg->emplace<Health>(entities[i], 100);
+            const bool calm = (i * 2654435761u >> 7) % 100 < percent;       // 乘法散列打散，分支预测不到
+            if (!calm) (void)reg->emplace<Burning>(entities[i]);
+            if (i % 2 == 0) (void)reg->emplace<Selected>(entities[i]);
+        }
+
+        size_t hits = 0;
+        const std::string suffix = " " + std::to_string(percent) + "% match";
+        ctx.measure("view(exclude, optional)" + suffix, CAPACITY * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                reg->view<Position, const Health>(exclude<Burning>, optional<const Selected>)
+                    .each([&hits](Entity, Position& p, const Health& h, const Selected* selected) {
+                        p.x += static_cast<float>(h.value);
+                        hits += selected != nullptr;
+                    });
+            }
+        });
+        // 对照：逐实体查签名
+        ctx.measure("per-entity has<>" + suffix, CAPACITY * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (Entity e : entities) {
+                    if (!reg->has<Health>(e) || reg->has<Burning>(e)) continue;
+                    reg->get<Position>(e).x += static_cast<float>(reg->get<Health>(e).value);
+                    hits += reg->has<Selected>(e);
+                }
+            }
+        });
+        Bench::do_not_optimize(hits);
+    }
+}
+
+// 每帧 1% 的实体翻转 Burning (相邻两帧翻同一批，匹配率保持在 percent% 附近)，然后遍历没在燃烧的实体
+RINN_BENCH(persistent_query) {
+    constexpr size_t FRAMES = 64;
+    for (const size_t percent : { 1, 10, 50 }) {
+        auto reg = std::make_unique<Registry>();
+        std::vector<Entity> entities(CAPACITY);
+        reg->create_entities(std::span<Entity>(entities));
+        for (size_t i = 0; i < entities.size(); ++i) {
+            (void)reg->emplace<Position>(entities[i], 0.0f, 0.0f);
+            (void)reg->emplace<Health>(entities[i], 100);
+            if ((i * 2654435761u >> 7) % 100 >= percent) (void)reg->emplace<Burning>(entities[i]);
+        }
+        const size_t churn = CAPACITY / 100;
+        const auto toggle = [&](size_t frame) {
+            for (size_t k = 0; k < churn; ++k) {
+                const Entity e = entities[(frame / 2 * churn + k) * 7919 % entities.size()];
+                if (reg->has<Burning>(e)) reg->remove<Burning>(e);
+                else (void)reg->emplace<Burning>(e);
+            }
+        };
+        const auto work = [](Entity, Position& p, const Health& h) { p.x += static_cast<float>(h.value); };
+
+        const std::string suffix = " " + std::to_string(percent) + "% match";
+        ctx.measure("churn + view(exclude)" + suffix, CAPACITY * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                toggle(frame);
+                reg->view<Position, const Health>(exclude<Burning>).each(work);
+            }
+        });
+
+        auto query = reg->persistent_query<Position, const Health>(exclude<Burning>);
+        ctx.measure("churn + persistent_query" + suffix, CAPACITY * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                toggle(frame);
+                query.each(work);
+            }
+        });
+
+        const QueryStats stats = query.stats();
+        std::printf("  %-28s %zu checks, %zu inserts, %zu erases for %zu visits; %zu view candidates skipped\n", "",
+            stats.signature_checks, stats.inserts, stats.erases, stats.visited, stats.skipped_candidates());
+    }
+}
+
+// 生命周期信号：发信号本身的开销，以及 “只处理新挂上的组件” 时信号与每帧轮询 added_since 的对比
+RINN_BENCH(lifecycle_signals) {
+    auto reg = std::make_unique<Registry>();
+    std::vector<Entity> entities(CAPACITY);
+    reg->create_entities(std::span<Entity>(entities));
+
+    const auto churn_ops = [&](const std::string& name) {
+        ctx.measure("emplace + remove<Position> " + name, CAPACITY * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (Entity e : entities) (void)reg->emplace<Position>(e, 1.0f, 2.0f);
+                for (Entity e : entities) reg->remove<Position>(e);
+            }
+        });
+    };
+    churn_ops("(no listener)");
+    size_t seen = 0;
+    const auto a = reg->on_construct<Position>().connect([&](Registry&, Entity) { ++seen; });
+    const auto b = reg->on_destroy<Position>().connect([&](Registry&, Entity) { ++seen; });
+    churn_ops("(immediate listener)");
+    reg->on_construct<Position>().disconnect(a);
+    reg->on_destroy<Position>().disconnect(b);
+    const auto batch = [&](Registry&, std::span<const Entity> es) { seen += es.size(); };
+    reg->on_construct<Position>().connect_batched(batch);
+    reg->on_destroy<Position>().connect_batched(batch);
+    ctx.measure("emplace + remove<Position> (batched listener)", CAPACITY * ROUNDS, [&] {
+        for (size_t round = 0; round < ROUNDS; ++round) {
+            for (Entity e : entities) (void)reg->emplace<Position>(e, 1.0f, 2.0f);
+            for (Entity e : entities) reg->remove<Position>(e);
+            reg->flush_signals();
+        }
+    });
+    Bench::do_not_optimize(seen);
+
+    // 每帧 1% 的实体重新挂 Health，反应式系统只关心这些实体
+    constexpr size_t FRAMES = 64;
+    for (Entity e : entities) (void)reg->emplace<Health>(e, 100);
+    const size_t churn = CAPACITY / 100;
+    const auto respawn = [&](size_t frame) {
+        for (size_t k = 0; k < churn; ++k) {
+            const Entity e = entities[(frame * churn + k) * 7919 % entities.size()];
+            reg->remove<Health>(e);
+            (void)reg->emplace<Health>(e, 100);
+        }
+    };
+
+    size_t handled = 0;
+    ctx.measure("respawn + poll added_since", churn * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            const Tick since = reg->advance_tick();
+            respawn(frame);
+            reg->view<const Health>().added_since(since).each([&](Entity, const Health& h) { handled += h.value; });
+        }
+    });
+
+    reg->on_construct<Health>().connect_batched([&](Registry& r, std::span<const Entity> es) {
+        for (Entity e : es) handled += std::as_const(r).get<Health>(e).value;
+    });
+    ctx.measure("respawn + on_construct (batched)", churn * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            (void)reg->advance_tick();
+            respawn(frame);
+            reg->flush_signals();
+        }
+    });
+    Bench::do_not_optimize(handled);
+}
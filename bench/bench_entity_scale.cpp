@@ -0,0 +1,62 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "components/Components.hpp"
+#include "Systems/MovementSystem.hpp"
+#include <memory>
+#include <vector>
+
+// ============================================================================
+// 宽句柄配置 (WideEntityTraits: 64 位句柄，4M 容量) 下 1M 实体的吞吐
+// ============================================================================
+namespace {
+    using namespace Rinn;
+    using WideRegistry = BasicRegistry<WideEntityTraits>;
+    constexpr size_t ENTITY_COUNT = 1'000'000;
+}
+
+RINN_BENCH(wide_entity_1m) {
+    // 宽配置下 Registry 本体只有几百字节，但习惯上仍放在堆上
+    auto reg = std::make_unique<WideRegistry>();
+    std::vector<WideRegistry::Entity> entities(ENTITY_COUNT);
+
+    ctx.measure_once("create_entity", ENTITY_COUNT, [&] {
+        for (auto& e : entities) e = reg->create_entity();
+    });
+
+    ctx.measure_once("emplace Transform + Velocity", ENTITY_COUNT, [&] {
+        for (auto e : entities) {
+            (void)reg->emplace<Transform>(e, 0.0f, 0.0f);
+            (void)reg->emplace<Velocity>(e, 1.0f, 0.5f);
+        }
+    });
+
+    ctx.measure("view<const Transform, const Velocity>", ENTITY_COUNT, [&] {
+        float sum = 0.0f;
+        reg->view<const Transform, const Velocity>().each([&sum](WideRegistry::Entity, const Transform& t, const Velocity& v) {
+            sum += t.x * v.vx + t.y * v.vy;
+        });
+        Bench::do_not_optimize(sum);
+    });
+
+    ctx.measure("view<Transform, const Velocity>.each", ENTITY_COUNT, [&] {
+        reg->view<Transform, const Velocity>().each([](WideRegistry::Entity, Transform& t, const Velocity& v) {
+            t.x += v.vx;
+            t.y += v.vy;
+        });
+    });
+
+    auto movers = reg->group<Transform, const Velocity>();
+    ctx.measure("group integrate_movement", ENTITY_COUNT, [&] {
+        integrate_movement(movers, 1.0f);
+    });
+
+    ctx.measure_once("destroy_entity", ENTITY_COUNT, [&] {
+        for (auto e : entities) reg->destroy_entity(e);
+    });
+
+    // 复用路径：全部从空闲环中取回
+    ctx.measure_once("create_entity (recycled)", ENTITY_COUNT, [&] {
+        for (auto& e : entities) e = reg->create_entity();
+    });
+    Bench::do_not_optimize(reg->size());
+}
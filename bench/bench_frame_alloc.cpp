@@ -0,0 +1,139 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Core/Scheduler.hpp"
+#include "Core/Memory.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+// ============================================================================
+// 稳态帧的堆分配：allocs 一栏必须为 0，否则 abort (替换的全局 operator new 计数)
+// - 组件存储放在 StorageArena，系统临时数组从 Scheduler::frame_arena() 取
+// - 每帧：并行遍历、parallel_for、命令缓冲里的添加 / 移除、帧内临时查询结果
+// - 预热若干帧 (各缓冲长到峰值、帧分配器按峰值扩容) 后再计数
+// 另外对比组件池放在全局堆与 StorageArena 上的添加 / 移除开销，并检查反复 compact 后 arena 的 upstream 用量持平
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t ENTITY_COUNT = 10'000;
+    constexpr size_t WARMUP_FRAMES = 32;
+    constexpr size_t FRAMES = 600;
+
+    struct Position { float x, y; };
+    struct Motion { float vx, vy; };
+    struct Burning { int ticks; };
+
+    void require(bool condition, const char* what) {
+        if (condition) return;
+        std::fprintf(stderr, "allocation check failed: %s\n", what);
+        std::abort();
+    }
+
+    // 记录 upstream 当前借出的字节数
+    struct CountingResource final : std::pmr::memory_resource {
+        size_t live = 0;
+
+        void* do_allocate(size_t bytes, size_t align) override {
+            live += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, align);
+        }
+        void do_deallocate(void* ptr, size_t bytes, size_t align) override {
+            live -= bytes;
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+}
+
+RINN_BENCH(steady_state_frame) {
+    StorageArena storage(16u << 20);
+    auto reg = std::make_unique<Registry>(&storage);
+    JobSystem jobs(3);
+    Scheduler scheduler(*reg, jobs);
+
+    const std::vector<Entity> entities = reg->create_entities(ENTITY_COUNT);
+    for (size_t i = 0; i < entities.size(); ++i) {
+        (void)reg->emplace<Position>(entities[i], static_cast<float>(i), 0.0f);
+        (void)reg->emplace<Motion>(entities[i], 1.0f, 0.5f);
+    }
+
+    scheduler.add_view<Position, const Motion>("move", [](Entity, float dt, Position& p, const Motion& m) {
+        p.x += m.vx * dt;
+        p.y += m.vy * dt;
+    });
+
+    // 帧内临时结果：右半边的实体
+    size_t hits = 0;
+    scheduler.add<const Position>("query", [&scheduler, &hits](Registry& r, float) {
+        std::pmr::vector<Entity> found(&scheduler.frame_arena());
+        r.view<const Position>().each([&found](Entity e, const Position& p) {
+            if (p.x > 5000.0f) found.push_back(e);
+        });
+        hits += found.size();
+    });
+
+    // 每帧给 1% 的实体点火，下一帧熄灭 (结构性修改走命令缓冲)
+    // 命令缓冲是每线程一条、各自在首次使用时扩容：固定在调用线程，预热帧数才有确定的意义
+    size_t frame = 0;
+    scheduler.add<const Position>("burn", [&scheduler, &entities, &frame](Registry&, float) {
+        BasicCommandBuffer<DefaultEntityTraits>& commands = scheduler.commands();
+        for (size_t i = frame % 100; i < entities.size(); i += 100) {
+            if (frame % 2 == 0) commands.emplace<Burning>(entities[i], 3);
+            else commands.remove<Burning>(entities[i]);
+        }
+        ++frame;
+    }, SystemThread::Main);
+
+    scheduler.add<const Motion>("parallel", [&jobs](Registry& r, float) {
+        const auto& motions = r.storage<Motion>();
+        std::atomic<size_t> moving{ 0 };
+        jobs.parallel_for(motions.size(), 512, [&](size_t begin, size_t end) {
+            moving.fetch_add(end - begin, std::memory_order_relaxed);
+        });
+        Bench::do_not_optimize(moving.load());
+    });
+
+    for (size_t i = 0; i < WARMUP_FRAMES; ++i) scheduler.run(1.0f / 60.0f);
+
+    ctx.measure("Scheduler::run (4 systems, 10K entities)", FRAMES, [&] {
+        for (size_t i = 0; i < FRAMES; ++i) scheduler.run(1.0f / 60.0f);
+    });
+    Bench::do_not_optimize(hits);
+    require(Bench::results().back().allocs == 0, "steady-state frames hit the global heap");
+}
+
+RINN_BENCH(storage_arena) {
+    const auto churn = [](Registry& reg, const std::vector<Entity>& entities, size_t rounds) {
+        for (size_t round = 0; round < rounds; ++round) {
+            for (Entity e : entities) (void)reg.emplace<Position>(e, 0.0f, 0.0f);
+            for (Entity e : entities) reg.remove<Position>(e);
+            (void)reg.compact(CompactionPolicy::exact());
+        }
+    };
+    const auto measure = [&](const char* label, std::pmr::memory_resource* resource) {
+        auto reg = std::make_unique<Registry>(resource);
+        const std::vector<Entity> entities = reg->create_entities(ENTITY_COUNT);
+        ctx.measure(label, ENTITY_COUNT * 10, [&] { churn(*reg, entities, 10); });
+    };
+
+    measure("emplace/remove/compact: global heap", std::pmr::get_default_resource());
+    StorageArena storage(16u << 20);
+    measure("emplace/remove/compact: StorageArena", &storage);
+
+    // 反复扩容 / 收缩：arena 放不下时向 upstream 要的内存必须在预热后持平 (换下的旧数组被复用)
+    CountingResource upstream;
+    {
+        StorageArena small(64u << 10, &upstream);
+        auto reg = std::make_unique<Registry>(&small);
+        const std::vector<Entity> entities = reg->create_entities(ENTITY_COUNT);
+        churn(*reg, entities, WARMUP_FRAMES);
+        const size_t warm = upstream.live;
+        churn(*reg, entities, 200);
+        std::printf("  %-28s upstream %zu bytes after warm-up, %zu after 200 more rounds\n", "", warm, upstream.live);
+        require(upstream.live == warm, "StorageArena upstream memory grows across emplace/remove/compact rounds");
+    }
+    require(upstream.live == 0, "StorageArena did not return upstream memory");
+}
@@ -0,0 +1,89 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Scripting/ScriptContext.hpp"
+#include "Scripting/LuaBinder.hpp"
+#include <memory>
+#include <string>
+
+// ============================================================================
+// Lua 绑定调用开销：每个用例是一段 Lua 循环，n 次迭代 = n 次跨边界调用
+// 空循环一并测出，便于扣掉解释器自身的开销
+// (只有找到 external/lua 与 external/sol2 时才编进 rinn_bench)
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t CALLS = 200'000;
+
+    constexpr const char* SCRIPT = R"(
+        function bench_empty(n)
+            local s = 0
+            for i = 1, n do s = s + i end
+            return s
+        end
+
+        function bench_create_destroy(n)
+            for i = 1, n do destroy_entity(create_entity()) end
+        end
+
+        function bench_ref_read(n)
+            local t = ref_Transform(bench_entity)
+            local s = 0
+            for i = 1, n do s = s + t.x end
+            return s
+        end
+
+        function bench_ref_write(n)
+            local t = ref_Transform(bench_entity)
+            for i = 1, n do t.x = i end
+        end
+
+        function bench_get_table(n)
+            local s = 0
+            for i = 1, n do s = s + get_Transform(bench_entity).x end
+            return s
+        end
+
+        function bench_emplace_remove(n)
+            local e = bench_entity
+            for i = 1, n do
+                emplace_Sprite(e, { texture_id = 1, width = 16, height = 16 })
+                remove_Sprite(e)
+            end
+        end
+
+        function bench_has(n)
+            local c = 0
+            for i = 1, n do if has_Transform(bench_entity) then c = c + 1 end end
+            return c
+        end
+    )";
+}
+
+RINN_BENCH(lua_binding) {
+    auto reg = std::make_unique<Registry>();
+    ScriptContext ctx_lua;
+    sol::state& lua = ctx_lua.state();
+    bind_registry(lua, *reg);
+
+    const Entity entity = reg->create_entity();
+    (void)reg->emplace<Transform>(entity, 1.0f, 2.0f);
+    lua["bench_entity"] = entity;
+    ctx_lua.run(SCRIPT);
+
+    const auto run = [&](const char* function, const char* label) {
+        sol::protected_function fn = lua[function];
+        ctx.measure(label, CALLS, [&] {
+            const sol::protected_function_result result = fn(CALLS);
+            if (!result.valid()) throw sol::error(std::string("benchmark script failed: ") + function);
+        });
+    };
+
+    run("bench_empty", "empty Lua loop (baseline)");
+    run("bench_create_destroy", "create_entity + destroy_entity");
+    run("bench_has", "has_Transform");
+    run("bench_ref_read", "ref_Transform field read");
+    run("bench_ref_write", "ref_Transform field write");
+    run("bench_get_table", "get_Transform (table)");
+    run("bench_emplace_remove", "emplace_Sprite + remove_Sprite");
+}
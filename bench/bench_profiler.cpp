@@ -0,0 +1,81 @@
+#include "BenchHarness.hpp"
+#include "Core/Profiler.hpp"
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// 帧分析器开销：直接使用 ProfileZone (不依赖 RINN_PROFILE 宏)
+// - 运行期关闭：只剩一次原子读
+// - 记录：两次取时 + 写本线程环形缓冲
+// - 多线程同时记录 (每线程独立缓冲，无共享写)
+// - 汇总 / 导出一整块缓冲
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t ZONES = 1'000'000;
+    constexpr size_t THREADS = 4;
+}
+
+RINN_BENCH(profiler_zone) {
+    Profiler& profiler = Profiler::instance();
+    size_t work = 0;
+
+    ctx.measure("empty scope (baseline)", ZONES, [&] {
+        for (size_t i = 0; i < ZONES; ++i) Bench::do_not_optimize(++work);
+    });
+
+    profiler.set_enabled(false);
+    ctx.measure("ProfileZone (runtime disabled)", ZONES, [&] {
+        for (size_t i = 0; i < ZONES; ++i) {
+            const ProfileZone zone("bench");
+            Bench::do_not_optimize(++work);
+        }
+    });
+
+    profiler.set_enabled(true);
+    ctx.measure("ProfileZone (recording)", ZONES, [&] {
+        for (size_t i = 0; i < ZONES; ++i) {
+            const ProfileZone zone("bench");
+            Bench::do_not_optimize(++work);
+        }
+    });
+
+    ctx.measure("ProfileZone (recording, 4 threads)", ZONES, [&] {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < THREADS; ++t) {
+            threads.emplace_back([] {
+                for (size_t i = 0; i < ZONES / THREADS; ++i) {
+                    const ProfileZone zone("bench thread");
+                    Bench::do_not_optimize(i);
+                }
+            });
+        }
+        for (std::thread& thread : threads) thread.join();
+    });
+    profiler.clear();
+}
+
+RINN_BENCH(profiler_export) {
+    Profiler& profiler = Profiler::instance();
+    profiler.set_enabled(true);
+    profiler.clear();
+    for (size_t i = 0; i < ProfileRing::CAPACITY; ++i) {
+        const ProfileZone zone(i % 2 ? "odd" : "even");
+    }
+
+    size_t zones = 0;
+    ctx.measure("summarize (64K events)", ProfileRing::CAPACITY, [&] {
+        zones = profiler.summarize().size();
+    });
+    Bench::do_not_optimize(zones);
+
+    const std::string path = "rinn_bench_trace.json";
+    ctx.measure("write_chrome_trace (64K events)", ProfileRing::CAPACITY, [&] {
+        (void)profiler.write_chrome_trace(path.c_str());
+    });
+    std::remove(path.c_str());
+    profiler.clear();
+}
@@ -0,0 +1,117 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Systems/RenderQueue.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+// ============================================================================
+// RenderQueue 构建 (剔除 + 排序键 + 基数排序 + 切 run)，无窗口
+// 精灵随机散布在 4x 屏幕大小的世界里，相机只看中间一屏，约 1/4 可见
+// 另外：组件池原地按 (layer, y) 排序，View 直接按绘制顺序遍历
+// - 逆序输入 (走 std::sort)、每帧 1% 精灵小幅移动 (走插入排序)、Sprite 池跟随 Transform 池
+// ============================================================================
+namespace {
+    using namespace Rinn;
+    using WideRegistry = BasicRegistry<WideEntityTraits>;   // 默认配置只容纳 16384 实体
+
+    constexpr float SCREEN_W = 1280.0f;
+    constexpr float SCREEN_H = 720.0f;
+    constexpr uint16_t TEXTURE_COUNT = 32;
+    constexpr int LAYER_COUNT = 4;
+
+    void render_queue_case(Bench::Context& ctx, size_t sprite_count) {
+        auto reg = std::make_unique<WideRegistry>();
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> px(-SCREEN_W / 2, SCREEN_W * 1.5f);
+        std::uniform_real_distribution<float> py(-SCREEN_H / 2, SCREEN_H * 1.5f);
+        std::uniform_int_distribution<int> texture(0, TEXTURE_COUNT - 1);
+        std::uniform_int_distribution<int> layer(0, LAYER_COUNT - 1);
+
+        for (size_t i = 0; i < sprite_count; ++i) {
+            const auto e = reg->create_entity();
+            (void)reg->emplace<Transform>(e, px(rng), py(rng), layer(rng));
+            (void)reg->emplace<Sprite>(e, static_cast<uint16_t>(texture(rng)), 32.0f, 32.0f);
+        }
+
+        RenderQueue queue;
+        const CullRect camera{ 0.0f, 0.0f, SCREEN_W, SCREEN_H };
+        queue.build(*reg, camera);     // 预热：缓冲扩容到稳态
+
+        // 每帧都有写入：强制完整重建
+        constexpr size_t FRAMES = 50;
+        ctx.measure("build (per sprite)", sprite_count * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                queue.invalidate();
+                queue.build(*reg, camera);
+                Bench::do_not_optimize(queue.runs().size());
+            }
+        });
+
+        // 静态世界：池没有写入，变更 tick 直接命中上一帧结果
+        ctx.measure("build (static world, per sprite)", sprite_count * FRAMES, [&] {
+            for (size_t frame = 0; frame < FRAMES; ++frame) {
+                (void)reg->advance_tick();
+                queue.build(*reg, camera);
+                Bench::do_not_optimize(queue.runs().size());
+            }
+        });
+        std::printf("  %-28s visible %zu / culled %zu, %zu runs\n", "", queue.visible_count(), queue.culled(), queue.runs().size());
+    }
+}
+
+RINN_BENCH(pool_sort_10k) {
+    constexpr size_t COUNT = 10'000;
+    constexpr size_t FRAMES = 50;
+    auto reg = std::make_unique<WideRegistry>();
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> py(0.0f, SCREEN_H);
+    std::uniform_int_distribution<int> layer(0, LAYER_COUNT - 1);
+    for (size_t i = 0; i < COUNT; ++i) {
+        const auto e = reg->create_entity();
+        (void)reg->emplace<Transform>(e, 0.0f, py(rng), layer(rng));
+        if (i % 2 == 0) (void)reg->emplace<Sprite>(e, uint16_t{ 0 }, 32.0f, 32.0f);
+    }
+
+    const auto by_depth = [](const Transform& a, const Transform& b) { return a.layer != b.layer ? a.layer < b.layer : a.y < b.y; };
+    const auto by_depth_desc = [&by_depth](const Transform& a, const Transform& b) { return by_depth(b, a); };
+
+    ctx.measure("sort<Transform> (reversed input)", COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            if (frame % 2 == 0) reg->sort<Transform>(by_depth_desc);
+            else reg->sort<Transform>(by_depth);
+        }
+    });
+
+    // 帧间基本有序：每帧 1% 的精灵在 y 上挪几个像素
+    std::uniform_int_distribution<size_t> pick(0, COUNT - 1);
+    std::uniform_real_distribution<float> jitter(-4.0f, 4.0f);
+    auto& transforms = reg->storage<Transform>();
+    ctx.measure("sort<Transform> (1% moved per frame)", COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            for (size_t i = 0; i < COUNT / 100; ++i) transforms.data()[pick(rng)].y += jitter(rng);
+            reg->sort<Transform>(by_depth);
+        }
+    });
+
+    ctx.measure("sort_as<Sprite, Transform>", COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) reg->sort_as<Sprite, Transform>();
+    });
+
+    // View 以较小的 Sprite 池为候选，顺序应与 (layer, y) 一致 (Release 下 assert 关闭，不一致直接退出)
+    bool ordered = true;
+    Transform previous{ 0.0f, -1.0f, -1 };
+    reg->view<const Transform, const Sprite>().each([&](WideRegistry::Entity, const Transform& t, const Sprite&) {
+        ordered = ordered && !by_depth(t, previous);
+        previous = t;
+    });
+    if (!ordered) {
+        std::fprintf(stderr, "pool_sort: view is not in layer order\n");
+        std::abort();
+    }
+}
+
+RINN_BENCH(render_queue_10k) { render_queue_case(ctx, 10'000); }
+RINN_BENCH(render_queue_50k) { render_queue_case(ctx, 50'000); }
+RINN_BENCH(render_queue_100k) { render_queue_case(ctx, 100'000); }
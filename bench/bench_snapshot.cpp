@@ -0,0 +1,116 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Core/Snapshot.hpp"
+#include "components/Components.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// Registry 快照：16K 实体的世界写盘 / 映射读回
+// - Transform / Velocity / Health 行式，Drift 列式 (ColumnSet)，Name 含 std::string (走 SnapshotTraits)
+// - 销毁一部分实体：尸体环与版本号也要原样读回
+// - 读回后逐实体比对存活状态、组件值、tick 与分组前缀 (Release 下 assert 关闭，不一致直接退出)
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t CAPACITY = DefaultEntityTraits::MAX_ENTITIES;
+    constexpr size_t ROUNDS = 20;
+
+    struct Health { int value; };
+    struct Name { std::string text; };
+    struct Drift { float vx, vy; };
+}
+
+template<> struct Rinn::ColumnLayout<Drift> : Rinn::Columns<&Drift::vx, &Drift::vy> {};
+
+template<>
+struct Rinn::SnapshotTraits<Name> {
+    static void save(BinaryWriter& out, const Name& name) {
+        out.write(static_cast<uint32_t>(name.text.size()));
+        out.write_bytes(name.text.data(), name.text.size());
+    }
+    static Name load(BinaryReader& in) {
+        Name name;
+        name.text.resize(in.read<uint32_t>());
+        in.read_bytes(name.text.data(), name.text.size());
+        return name;
+    }
+};
+
+namespace {
+    void build_world(Registry& reg) {
+        const std::vector<Entity> entities = reg.create_entities(CAPACITY);
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const float f = static_cast<float>(i);
+            (void)reg.emplace<Transform>(entities[i], f, f * 0.5f, static_cast<int>(i % 4));
+            if (i % 2 == 0) (void)reg.emplace<Velocity>(entities[i], 1.0f, -1.0f);
+            if (i % 3 == 0) (void)reg.emplace<Health>(entities[i], static_cast<int>(i));
+            if (i % 5 == 0) (void)reg.emplace<Drift>(entities[i], f, -f);
+            if (i % 16 == 0) (void)reg.emplace<Name>(entities[i], "entity_" + std::to_string(i));
+        }
+        for (size_t i = 0; i < entities.size(); i += 7) reg.destroy_entity(entities[i]);
+        (void)reg.advance_tick();
+    }
+
+    void require(bool condition, const char* what) {
+        if (condition) return;
+        std::fprintf(stderr, "snapshot round-trip mismatch: %s\n", what);
+        std::abort();
+    }
+
+    void check_equal(Registry& a, Registry& b) {
+        require(a.size() == b.size() && a.tick() == b.tick(), "entity count / tick");
+        const auto& ta = a.storage<Transform>();
+        const auto& tb = b.storage<Transform>();
+        require(ta.size() == tb.size(), "Transform pool size");
+
+        const Registry& ca = a;
+        const Registry& cb = b;
+        for (size_t i = 0; i < ta.size(); ++i) {
+            const Entity e = ta.entity_data()[i];
+            require(tb.entity_data()[i] == e && cb.is_alive(e), "dense order / alive");
+            const Transform xa = ca.get<Transform>(e);
+            const Transform xb = cb.get<Transform>(e);
+            require(xa.x == xb.x && xa.y == xb.y && xa.layer == xb.layer, "Transform");
+            require(ta.added_tick(e) == tb.added_tick(e) && ta.changed_tick(e) == tb.changed_tick(e), "ticks");
+            require(ca.has<Velocity>(e) == cb.has<Velocity>(e) && ca.has<Health>(e) == cb.has<Health>(e)
+                && ca.has<Name>(e) == cb.has<Name>(e) && ca.has<Drift>(e) == cb.has<Drift>(e), "signature");
+            if (ca.has<Velocity>(e)) require(ca.get<Velocity>(e).vx == cb.get<Velocity>(e).vx, "Velocity");
+            if (ca.has<Health>(e)) require(ca.get<Health>(e).value == cb.get<Health>(e).value, "Health");
+            if (ca.has<Name>(e)) require(ca.get<Name>(e).text == cb.get<Name>(e).text, "Name");
+            if (ca.has<Drift>(e)) require(ca.get<Drift>(e).vy == cb.get<Drift>(e).vy, "Drift");
+        }
+
+        require(a.group<Transform, Velocity>().size() == b.group<Transform, Velocity>().size(), "group prefix");
+        // 新实体应复用同一个尸体索引 (同一版本号)
+        require(a.create_entity() == b.create_entity(), "free ring order");
+    }
+}
+
+RINN_BENCH(snapshot) {
+    const std::string path = (std::filesystem::temp_directory_path() / "rinn_bench.snap").string();
+
+    auto source = std::make_unique<Registry>();
+    build_world(*source);
+
+    ctx.measure("save_snapshot (16K entities)", ROUNDS, [&] {
+        for (size_t i = 0; i < ROUNDS; ++i) require(save_snapshot(*source, path.c_str()), "save failed");
+    });
+
+    // 目标 registry 的组件 ID 与保存时相同：签名整块拷贝
+    auto target = std::make_unique<Registry>();
+    ctx.measure("load_snapshot (16K entities)", ROUNDS, [&] {
+        for (size_t i = 0; i < ROUNDS; ++i) {
+            require(load_snapshot<Transform, Velocity, Health, Name, Drift>(*target, path.c_str()), "load failed");
+        }
+    });
+    check_equal(*source, *target);
+
+    std::printf("  %-28s %zu KB on disk\n", "", static_cast<size_t>(std::filesystem::file_size(path) / 1024));
+    std::filesystem::remove(path);
+}
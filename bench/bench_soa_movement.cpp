@@ -0,0 +1,83 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Systems/MovementSystem.hpp"
+#include <memory>
+
+// ============================================================================
+// 同一份移动积分，AoS 与 SoA 对照
+// - AoS：引擎的 Transform / Velocity，走 SparseSet (layer 等字段一起进缓存)
+// - SoA：本地的 Position / Speed 声明了 ColumnLayout，分组列上跑标量循环与 SSE 版本
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t ENTITY_COUNT = 1'000'000;
+    constexpr size_t FRAMES = 10;
+    constexpr float DT = 1.0f / 60.0f;
+
+    // 与 Transform / Velocity 字段一致，只是按列存储
+    struct Position {
+        float x, y;
+        int layer = 0;
+    };
+    struct Speed {
+        float vx, vy;
+    };
+
+    using WideRegistry = BasicRegistry<WideEntityTraits>;
+}
+
+template<> struct Rinn::ColumnLayout<Position> : Rinn::Columns<&Position::x, &Position::y, &Position::layer> {};
+template<> struct Rinn::ColumnLayout<Speed> : Rinn::Columns<&Speed::vx, &Speed::vy> {};
+
+RINN_BENCH(soa_movement_1m) {
+    auto reg = std::make_unique<WideRegistry>();
+    for (size_t i = 0; i < ENTITY_COUNT; ++i) {
+        const auto e = reg->create_entity();
+        const float f = static_cast<float>(i);
+        (void)reg->emplace<Position>(e, f, f);
+        (void)reg->emplace<Speed>(e, 1.0f, 0.5f);
+        (void)reg->emplace<Transform>(e, f, f);
+        (void)reg->emplace<Velocity>(e, 1.0f, 0.5f);
+    }
+
+    ctx.measure("AoS view<Transform, const Velocity>", ENTITY_COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            reg->view<Transform, const Velocity>().each([](WideRegistry::Entity, Transform& t, const Velocity& v) {
+                t.x += v.vx * DT;
+                t.y += v.vy * DT;
+            });
+        }
+    });
+
+    auto rows = reg->group<Transform, const Velocity>();
+    ctx.measure("AoS group<Transform, Velocity>", ENTITY_COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            integrate_movement(rows, DT);
+        }
+    });
+
+    auto movers = reg->group<Position, Speed>();
+    ctx.measure("SoA columns (scalar)", ENTITY_COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            integrate_scalar(movers.column<&Position::x>(), movers.read_column<&Speed::vx>(), DT);
+            integrate_scalar(movers.column<&Position::y>(), movers.read_column<&Speed::vy>(), DT);
+        }
+    });
+
+    ctx.measure("SoA columns (SIMD)", ENTITY_COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            integrate_columns<&Position::x, &Position::y, &Speed::vx, &Speed::vy>(movers, DT);
+        }
+    });
+
+    JobSystem jobs;
+    ctx.measure("SoA columns (SIMD, parallel)", ENTITY_COUNT * FRAMES, [&] {
+        for (size_t frame = 0; frame < FRAMES; ++frame) {
+            integrate_columns<&Position::x, &Position::y, &Speed::vx, &Speed::vy>(movers, DT, jobs, 16 * 1024);
+        }
+    });
+
+    Bench::do_not_optimize(std::as_const(*reg).get<Position>(movers.entities()[0]));
+    Bench::do_not_optimize(std::as_const(*reg).get<Transform>(rows.entities()[0]));
+}
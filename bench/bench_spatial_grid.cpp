@@ -0,0 +1,124 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Systems/SpatialGrid.hpp"
+#include "Systems/MovementSystem.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+// ============================================================================
+// 10k 移动个体：每 tick 移动 -> 增量更新网格 -> 每个个体做一次邻居查询
+// 另有稳态 tick：1% 移动 + 少量销毁 / 新建，网格只处理变化的部分
+// 对照组：暴力 O(N²) 扫描 view<Transform>
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    constexpr size_t AGENT_COUNT = 10'000;
+    constexpr float WORLD_SIZE = 4096.0f;
+    constexpr float QUERY_RADIUS = 48.0f;
+    constexpr size_t TICKS = 20;
+
+    struct World {
+        std::unique_ptr<Registry> reg = std::make_unique<Registry>();
+        std::vector<Entity> agents;
+        Group<Transform, const Velocity> movers;
+
+        World() : movers(reg->group<Transform, const Velocity>()) {
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<float> pos(0.0f, WORLD_SIZE);
+            std::uniform_real_distribution<float> vel(-2.0f, 2.0f);
+            agents.reserve(AGENT_COUNT);
+            for (size_t i = 0; i < AGENT_COUNT; ++i) {
+                const Entity e = reg->create_entity();
+                (void)reg->emplace<Transform>(e, pos(rng), pos(rng));
+                (void)reg->emplace<Velocity>(e, vel(rng), vel(rng));
+                agents.push_back(e);
+            }
+        }
+
+        void move() {
+            integrate_movement(movers, 1.0f);
+        }
+    };
+}
+
+RINN_BENCH(spatial_grid_10k) {
+    World world;
+    SpatialGrid grid(QUERY_RADIUS);
+    grid.update(*world.reg);
+
+    std::vector<Entity> hits;
+    std::vector<SpatialGrid::Neighbor> nearest;
+    size_t total_hits = 0;
+
+    ctx.measure("update (moving agents)", AGENT_COUNT * TICKS, [&] {
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            world.move();
+            grid.update(*world.reg);
+        }
+    });
+
+    ctx.measure("query_radius per agent", AGENT_COUNT * TICKS, [&] {
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            world.reg->view<const Transform>().each([&](Entity, const Transform& t) {
+                total_hits += grid.query_radius(t.x, t.y, QUERY_RADIUS, hits);
+            });
+        }
+    });
+
+    ctx.measure("query_nearest(k=8) per agent", AGENT_COUNT * TICKS, [&] {
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            world.reg->view<const Transform>().each([&](Entity, const Transform& t) {
+                total_hits += grid.query_nearest(t.x, t.y, 8, nearest);
+            });
+        }
+    });
+
+    ctx.measure("tick: move + update + radius", AGENT_COUNT * TICKS, [&] {
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            world.move();
+            grid.update(*world.reg);
+            world.reg->view<const Transform>().each([&](Entity, const Transform& t) {
+                total_hits += grid.query_radius(t.x, t.y, QUERY_RADIUS, hits);
+            });
+        }
+    });
+
+    // 稳态：每 tick 只有 1% 的个体移动、10 个被销毁后补上新的
+    // 移除按 destroy 事件处理，不再逐条检查全部条目，开销跟着变化量走
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<size_t> pick(0, AGENT_COUNT - 1);
+    ctx.measure("update (1% moved, 10 respawned)", AGENT_COUNT * TICKS, [&] {
+        for (size_t tick = 0; tick < TICKS; ++tick) {
+            (void)world.reg->advance_tick();
+            for (size_t i = 0; i < AGENT_COUNT / 100; ++i) world.reg->get<Transform>(world.agents[pick(rng)]).x += 1.0f;
+            for (size_t i = 0; i < 10; ++i) {
+                Entity& agent = world.agents[pick(rng)];
+                world.reg->destroy_entity(agent);
+                agent = world.reg->create_entity();
+                (void)world.reg->emplace<Transform>(agent, 16.0f, 16.0f);
+                (void)world.reg->emplace<Velocity>(agent, 0.0f, 0.0f);
+            }
+            grid.update(*world.reg);
+        }
+    });
+    if (grid.size() != AGENT_COUNT) {
+        std::fprintf(stderr, "spatial_grid: %zu entries for %zu agents\n", grid.size(), AGENT_COUNT);
+        std::abort();
+    }
+
+    // 对照：同样的半径查询用暴力扫描，只跑一个 tick
+    ctx.measure("brute force radius (1 tick)", AGENT_COUNT, [&] {
+        const float radius_sq = QUERY_RADIUS * QUERY_RADIUS;
+        world.reg->view<const Transform>().each([&](Entity, const Transform& a) {
+            world.reg->view<const Transform>().each([&](Entity, const Transform& b) {
+                const float dx = a.x - b.x, dy = a.y - b.y;
+                total_hits += dx * dx + dy * dy <= radius_sq;
+            });
+        });
+    });
+    Bench::do_not_optimize(total_hits);
+}
@@ -0,0 +1,83 @@
+#include "BenchHarness.hpp"
+#include "Core/Registry.hpp"
+#include "Core/StaticRegistry.hpp"
+#include "Scripting/ComponentList.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// 动态 Registry (运行期 ID、unique_ptr 池、虚函数) 与 StaticRegistry (AllComponents 的编译期 ID、tuple 池) 对照
+// 同一份工作负载分别跑两遍：
+//   - 挂全部 4 种组件
+//   - 随机顺序 get<Sprite>
+//   - view<const Transform, Sprite> 遍历
+//   - destroy_entity / clear
+// ============================================================================
+namespace {
+    using namespace Rinn;
+
+    // StaticRegistry 只是原型 (见 StaticRegistry.hpp)，别名只在这里定义，不对外暴露
+    using StaticRegistry = BasicStaticRegistry<AllComponents>;
+
+    constexpr size_t CAPACITY = DefaultEntityTraits::MAX_ENTITIES;
+    constexpr size_t ROUNDS = 64;
+
+    std::string label(const char* backend, const char* what) {
+        return std::string(backend) + ": " + what;
+    }
+
+    template<typename Reg>
+    void populate(Reg& reg, const std::vector<typename Reg::Entity>& entities) {
+        for (size_t i = 0; i < entities.size(); ++i) {
+            const float f = static_cast<float>(i);
+            (void)reg.template emplace<Transform>(entities[i], f, f);
+            (void)reg.template emplace<Velocity>(entities[i], 1.0f, 0.5f);
+            if (i % 2 == 0) (void)reg.template emplace<RigidBody>(entities[i], 0.0f, 0.0f);
+            (void)reg.template emplace<Sprite>(entities[i], Sprite{ 1, 16.0f, 16.0f });
+        }
+    }
+
+    template<typename Reg>
+    void workload(Bench::Context& ctx, const char* backend) {
+        auto reg = std::make_unique<Reg>();
+        std::vector<typename Reg::Entity> entities = reg->create_entities(CAPACITY);
+
+        ctx.measure_once(label(backend, "emplace x3.5"), CAPACITY, [&] {
+            populate(*reg, entities);
+        });
+
+        // 乘法散列打乱访问顺序
+        std::vector<typename Reg::Entity> shuffled(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i) shuffled[i] = entities[i * 7919 % entities.size()];
+        float sum = 0.0f;
+        ctx.measure(label(backend, "get<Sprite> (random order)"), CAPACITY * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                for (auto e : shuffled) sum += reg->template get<Sprite>(e).width;
+            }
+        });
+        ctx.measure(label(backend, "view<const Transform, Sprite>"), CAPACITY * ROUNDS, [&] {
+            for (size_t round = 0; round < ROUNDS; ++round) {
+                reg->template view<const Transform, Sprite>().each([&sum](auto, const Transform& t, Sprite& s) {
+                    sum += t.x * s.width;
+                });
+            }
+        });
+        Bench::do_not_optimize(sum);
+
+        ctx.measure_once(label(backend, "destroy_entity (3.5 components)"), CAPACITY, [&] {
+            reg->destroy_entities(entities);
+        });
+        entities = reg->create_entities(CAPACITY);
+        populate(*reg, entities);
+        ctx.measure_once(label(backend, "clear"), CAPACITY, [&] {
+            reg->clear();
+        });
+        Bench::do_not_optimize(reg->size());
+    }
+}
+
+RINN_BENCH(static_registry) {
+    workload<Registry>(ctx, "dynamic");
+    workload<StaticRegistry>(ctx, "static ");
+}
@@ -0,0 +1,119 @@
+#include "BenchHarness.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+// ============================================================================
+// rinn_bench：运行全部已注册用例
+//   rinn_bench                      -> 全部
+//   rinn_bench entity               -> 名字包含 "entity" 的用例
+//   rinn_bench --json out.json      -> 额外把结果写成 JSON (可与过滤参数同时使用)
+//   rinn_bench --repeat 10          -> 每个可重复的测量执行 10 次 (默认 5 次)，报告中位数与最小值
+// ============================================================================
+
+// ---------- 分配计数：替换全局 operator new / delete ----------
+namespace {
+    void* counted_alloc(std::size_t size) {
+        auto& counters = Rinn::Bench::allocations();
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(size, std::memory_order_relaxed);
+        if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+        throw std::bad_alloc();
+    }
+
+    void* counted_alloc(std::size_t size, std::align_val_t align) {
+        auto& counters = Rinn::Bench::allocations();
+        counters.count.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(size, std::memory_order_relaxed);
+        const std::size_t alignment = static_cast<std::size_t>(align);
+        const std::size_t rounded = (size + alignment - 1) / alignment * alignment;
+#if defined(_MSC_VER)
+        if (void* ptr = _aligned_malloc(rounded ? rounded : alignment, alignment)) return ptr;
+#else
+        if (void* ptr = std::aligned_alloc(alignment, rounded ? rounded : alignment)) return ptr;
+#endif
+        throw std::bad_alloc();
+    }
+
+    void counted_free(void* ptr, std::align_val_t) noexcept {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t size) { return counted_alloc(size); }
+void* operator new[](std::size_t size) { return counted_alloc(size); }
+void* operator new(std::size_t size, std::align_val_t align) { return counted_alloc(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return counted_alloc(size, align); }
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t align) noexcept { counted_free(ptr, align); }
+void operator delete[](void* ptr, std::align_val_t align) noexcept { counted_free(ptr, align); }
+void operator delete(void* ptr, std::size_t, std::align_val_t align) noexcept { counted_free(ptr, align); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t align) noexcept { counted_free(ptr, align); }
+
+// ---------- JSON 输出 ----------
+namespace {
+    void write_json_string(std::FILE* out, std::string_view text) {
+        std::fputc('"', out);
+        for (const char c : text) {
+            if (c == '"' || c == '\\') std::fputc('\\', out);
+            std::fputc(c, out);
+        }
+        std::fputc('"', out);
+    }
+
+    bool write_json(const char* path) {
+        std::FILE* out = std::fopen(path, "w");
+        if (out == nullptr) return false;
+
+        std::fprintf(out, "{\n  \"results\": [\n");
+        const auto& results = Rinn::Bench::results();
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Rinn::Bench::Result& r = results[i];
+            std::fprintf(out, "    { \"case\": ");
+            write_json_string(out, r.case_name);
+            std::fprintf(out, ", \"label\": ");
+            write_json_string(out, r.label);
+            std::fprintf(out, ", \"ops\": %zu, \"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f, \"ops_per_sec\": %.0f, \"allocs\": %zu, \"alloc_bytes\": %zu, \"repetitions\": %zu }%s\n",
+                r.ops, r.ns_per_op, r.min_ns_per_op, r.ops_per_sec, r.allocs, r.alloc_bytes, r.repetitions, i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+        return std::fclose(out) == 0;
+    }
+}
+
+int main(int argc, char** argv) {
+    using namespace Rinn::Bench;
+
+    std::string_view filter;
+    const char* json_path = nullptr;
+    size_t repetitions = Context::DEFAULT_REPETITIONS;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) json_path = argv[++i];
+        else if (arg == "--repeat" && i + 1 < argc) repetitions = std::strtoul(argv[++i], nullptr, 10);
+        else filter = arg;
+    }
+
+    for (const Case& c : cases()) {
+        if (!filter.empty() && std::string_view(c.name).find(filter) == std::string_view::npos) {
+            continue;
+        }
+        std::printf("[%s]\n", c.name);
+        Context ctx(c.name, repetitions);
+        c.fn(ctx);
+    }
+
+    if (json_path != nullptr && !write_json(json_path)) {
+        std::fprintf(stderr, "failed to write %s\n", json_path);
+        return 1;
+    }
+    return 0;
+}
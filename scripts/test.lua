@@ -20,4 +20,24 @@ emplace_Transform(e2, {x = 400, y = 200})
 emplace_Sprite(e2, {texture_id = tex_pub, width = 256, height = 256})
 print("创建实体 e2: pub @ (400, 200)")
 
+-- 3. 零拷贝代理：直接读写组件内存，不分配 table
+local t2 = ref_Transform(e2)
+t2.y = t2.y + 50
+print("e2 Transform 代理: (" .. t2.x .. ", " .. t2.y .. ")")
+
+-- 4. 批量：一次调用刷出一波实体 (结构数组形式，每列一个 Lua 数组)
+local wave = create_entities(8)
+local xs, ys = {}, {}
+for i = 1, #wave do
+    xs[i] = 80 * i
+    ys[i] = 500
+end
+emplace_many_Transform(wave, {x = xs, y = ys})
+print("批量创建实体: " .. #wave .. " 个")
+
+-- 5. 空间查询：结果写回复用的数组，返回命中数 (网格在第一帧 update 后才有数据)
+local hits = {}
+local n = query_radius(400, 200, 128, hits)
+print("e2 附近实体: " .. n .. " 个")
+
 print("=== 初始化完成，等待渲染 ===")
\ No newline at end of file
@@ -0,0 +1,165 @@
+#pragma once
+#include "Types.hpp"
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Rinn {
+
+	// 组件的类型擦除信息：实体在 Archetype 之间搬家时只知道组件 ID
+	struct ComponentInfo {
+		size_t size = 0;
+		void (*relocate)(void* dst, void* src) = nullptr;	// 移动构造到 dst，并析构 src
+		void (*destroy)(void* ptr) = nullptr;
+
+		template<typename T>
+		[[nodiscard]] static ComponentInfo of() noexcept {
+			static_assert(alignof(T) <= 64, "Archetype columns are 64-byte aligned at most!");
+			ComponentInfo info;
+			info.size = sizeof(T);
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				info.relocate = [](void* dst, void* src) { std::memcpy(dst, src, sizeof(T)); };
+				info.destroy = [](void*) {};
+			}
+			else {
+				info.relocate = [](void* dst, void* src) {
+					T* from = static_cast<T*>(src);
+					::new (dst) T(std::move(*from));
+					from->~T();
+				};
+				info.destroy = [](void* ptr) { static_cast<T*>(ptr)->~T(); };
+			}
+			return info;
+		}
+	};
+
+	// 块内存：64 字节对齐，整块一次分配
+	struct ChunkDeleter {
+		void operator()(std::byte* ptr) const noexcept { ::operator delete(ptr, std::align_val_t{ 64 }); }
+	};
+	using ChunkMemory = std::unique_ptr<std::byte, ChunkDeleter>;
+
+	// =========================================================================
+	// Archetype：签名完全相同的实体存放在一起
+	// -------------------------------------------------------------------------
+	// - 行按固定大小的块 (Chunk，默认 16KB) 存放，块内每个组件一列，另有实体列与两列 tick
+	//   [entities | C0 | C0.changed | C0.added | C1 | ...]，每段 64 字节对齐
+	// - 行号在整个 Archetype 内连续：row -> (row / chunk_capacity, row % chunk_capacity)
+	//   除最后一块外全部填满，删除时用最后一行补洞 (swap-and-pop)
+	// - add_edge / remove_edge 缓存 “加 / 减一个组件后去哪个 Archetype”，结构变化不必每次查表
+	// =========================================================================
+	template<typename Traits>
+	struct Archetype {
+		using Entity = BasicEntity<Traits>;
+
+		static constexpr size_t CHUNK_BYTES = 16 * 1024;
+		static constexpr size_t ALIGN = 64;
+		static constexpr uint8_t NO_COLUMN = 0xFF;
+		static constexpr uint32_t NO_ARCHETYPE = 0xFFFFFFFF;
+
+		struct Column {
+			Component_ID id;
+			size_t size;
+			size_t data;		// 以下均为块内偏移
+			size_t changed;
+			size_t added;
+		};
+
+		Signature signature;
+		std::vector<Column> columns;					// 按组件 ID 升序
+		std::array<uint8_t, MAX_COMPONENTS> column_of;	// 组件 ID -> 列号
+		std::array<uint32_t, MAX_COMPONENTS> add_edge;
+		std::array<uint32_t, MAX_COMPONENTS> remove_edge;
+
+		size_t chunk_capacity = 0;		// 每块行数
+		size_t chunk_bytes = CHUNK_BYTES;
+		size_t count = 0;				// 总行数
+		std::vector<ChunkMemory> chunks;
+
+		Archetype(const Signature& signature, const std::array<ComponentInfo, MAX_COMPONENTS>& infos) : signature(signature) {
+			column_of.fill(NO_COLUMN);
+			add_edge.fill(NO_ARCHETYPE);
+			remove_edge.fill(NO_ARCHETYPE);
+
+			size_t row_bytes = sizeof(Entity);
+			for (Component_ID id = 0; id < MAX_COMPONENTS; ++id) {
+				if (!signature[id]) continue;
+				column_of[id] = static_cast<uint8_t>(columns.size());
+				columns.push_back({ id, infos[id].size, 0, 0, 0 });
+				row_bytes += infos[id].size + 2 * sizeof(Tick);
+			}
+
+			// 每段最多浪费 ALIGN 字节的对齐填充；单行放不进 16KB 时块按一行的大小放大
+			const size_t padding = ALIGN * (1 + 3 * columns.size());
+			chunk_capacity = std::max<size_t>(1, (CHUNK_BYTES - std::min(CHUNK_BYTES, padding)) / row_bytes);
+
+			size_t offset = align_up(chunk_capacity * sizeof(Entity));
+			for (Column& column : columns) {
+				column.data = offset;
+				offset = align_up(offset + chunk_capacity * column.size);
+				column.changed = offset;
+				offset = align_up(offset + chunk_capacity * sizeof(Tick));
+				column.added = offset;
+				offset = align_up(offset + chunk_capacity * sizeof(Tick));
+			}
+			chunk_bytes = std::max(CHUNK_BYTES, offset);
+		}
+
+		[[nodiscard]] bool has_column(Component_ID id) const noexcept { return column_of[id] != NO_COLUMN; }
+
+		// 有数据的块数 (尾部可能还留着一块空块备用)
+		[[nodiscard]] size_t chunk_count() const noexcept { return (count + chunk_capacity - 1) / chunk_capacity; }
+		[[nodiscard]] size_t rows_in(size_t chunk) const noexcept { return std::min(chunk_capacity, count - chunk * chunk_capacity); }
+
+		[[nodiscard]] std::byte* base(size_t chunk) const noexcept { return chunks[chunk].get(); }
+		[[nodiscard]] Entity* entities(size_t chunk) const noexcept { return reinterpret_cast<Entity*>(base(chunk)); }
+
+		template<typename T>
+		[[nodiscard]] T* column(size_t chunk, uint8_t col) const noexcept {
+			return std::launder(reinterpret_cast<T*>(base(chunk) + columns[col].data));
+		}
+		[[nodiscard]] Tick* changed_ticks(size_t chunk, uint8_t col) const noexcept {
+			return reinterpret_cast<Tick*>(base(chunk) + columns[col].changed);
+		}
+		[[nodiscard]] Tick* added_ticks(size_t chunk, uint8_t col) const noexcept {
+			return reinterpret_cast<Tick*>(base(chunk) + columns[col].added);
+		}
+
+		// 按行号访问
+		[[nodiscard]] Entity& entity_at(size_t row) const noexcept {
+			return entities(row / chunk_capacity)[row % chunk_capacity];
+		}
+		[[nodiscard]] void* slot(size_t row, uint8_t col) const noexcept {
+			return base(row / chunk_capacity) + columns[col].data + (row % chunk_capacity) * columns[col].size;
+		}
+		[[nodiscard]] Tick& changed_at(size_t row, uint8_t col) const noexcept {
+			return changed_ticks(row / chunk_capacity, col)[row % chunk_capacity];
+		}
+		[[nodiscard]] Tick& added_at(size_t row, uint8_t col) const noexcept {
+			return added_ticks(row / chunk_capacity, col)[row % chunk_capacity];
+		}
+
+		// 追加一行 (组件列未构造，由调用方填)，返回行号
+		size_t push_row(Entity entity) {
+			if (count == chunks.size() * chunk_capacity) {
+				chunks.emplace_back(static_cast<std::byte*>(::operator new(chunk_bytes, std::align_val_t{ ALIGN })));
+			}
+			const size_t row = count++;
+			::new (&entity_at(row)) Entity(entity);
+			return row;
+		}
+
+		// 释放多余的空块：保留一块备用，避免在块边界上反复添加 / 删除时来回分配
+		void trim() noexcept {
+			while (chunks.size() > chunk_count() + 1) chunks.pop_back();
+		}
+
+		[[nodiscard]] size_t memory_bytes() const noexcept { return chunks.size() * chunk_bytes; }
+
+	private:
+		[[nodiscard]] static constexpr size_t align_up(size_t value) noexcept {
+			return (value + ALIGN - 1) & ~(ALIGN - 1);
+		}
+	};
+}
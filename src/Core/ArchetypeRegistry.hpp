@@ -0,0 +1,651 @@
+#pragma once
+#include "Registry.hpp"
+#include "Archetype.hpp"
+#include <unordered_map>
+
+namespace Rinn {
+
+	template<typename Traits, typename... Components> class BasicArchetypeView;
+	template<typename T, typename Traits> class ArchetypeStorage;
+
+	// 与 ISparseSet::last_write 对应：每个组件一份，记录该组件最近一次被写的 tick
+	class IArchetypeStorage {
+	public:
+		virtual ~IArchetypeStorage() = default;
+
+		[[nodiscard]] Tick last_write() const noexcept { return last_write_tick.load(std::memory_order_relaxed); }
+
+		// 并行遍历中多个线程会同时标记：先读后写
+		void touch(Tick tick) noexcept {
+			if (last_write_tick.load(std::memory_order_relaxed) != tick) {
+				last_write_tick.store(tick, std::memory_order_relaxed);
+			}
+		}
+
+	private:
+		std::atomic<Tick> last_write_tick{ 0 };
+	};
+
+	// =========================================================================
+	// Archetype 后端的 Registry (与 BasicRegistry 二选一，按 Registry 选择)
+	// -------------------------------------------------------------------------
+	// - 签名相同的实体放在同一个 Archetype 的块里 (见 Archetype.hpp)，多组件查询只遍历签名匹配的块，
+	//   不会像稀疏集 View 那样在最小池里逐个检查不匹配的实体
+	// - 代价是结构变化：加 / 删组件要把整行搬到另一个 Archetype
+	// - 接口与 BasicRegistry 一致：create_entity / emplace / get / try_get / has / remove / view / storage / tick，
+	//   RenderQueue、LuaBinder 等按 Registry 类型泛化的代码可直接使用
+	// - 没有拥有型分组，也不区分列式组件 (块内每个组件本来就是一列)
+	// =========================================================================
+	template<typename Traits = DefaultEntityTraits>
+	class BasicArchetypeRegistry {
+	public:
+		using traits_type = Traits;
+		using Entity = BasicEntity<Traits>;
+
+		template<typename T>
+		using pool_type = ArchetypeStorage<T, Traits>;
+
+	private:
+		template<typename, typename...> friend class BasicArchetypeView;
+		template<typename, typename> friend class ArchetypeStorage;
+
+		using ArchetypeT = Archetype<Traits>;
+		static constexpr uint32_t NO_ARCHETYPE = ArchetypeT::NO_ARCHETYPE;
+
+		// 实体所在的 Archetype 与行号；没有任何组件的实体不占行
+		struct Location {
+			uint32_t archetype = NO_ARCHETYPE;
+			uint32_t row = 0;
+		};
+
+		BasicEntityPool<Traits> entity_pool;
+		EntityArray<Location, Traits::MAX_ENTITIES> locations;
+
+		std::vector<std::unique_ptr<ArchetypeT>> archetypes;
+		std::unordered_map<Signature, uint32_t> archetype_index;
+
+		std::array<ComponentInfo, MAX_COMPONENTS> infos;
+		std::array<std::unique_ptr<IArchetypeStorage>, MAX_COMPONENTS> storages;		// 首次使用组件时创建
+
+		Tick current_tick = 1;
+
+		// 登记组件类型信息 (延迟初始化，与 BasicRegistry::get_pool 相同)
+		template<typename T>
+		Component_ID register_component() {
+			const Component_ID id = get_component_type_id<T>();
+			assert(id < MAX_COMPONENTS && "Too many component types!");
+			if (storages[id] == nullptr) {
+				infos[id] = ComponentInfo::of<T>();
+				storages[id] = std::make_unique<ArchetypeStorage<T, Traits>>(*this);
+			}
+			return id;
+		}
+
+		uint32_t find_or_create(const Signature& signature) {
+			if (auto it = archetype_index.find(signature); it != archetype_index.end()) return it->second;
+			const uint32_t index = static_cast<uint32_t>(archetypes.size());
+			archetypes.push_back(std::make_unique<ArchetypeT>(signature, infos));
+			archetype_index.emplace(signature, index);
+			return index;
+		}
+
+		uint32_t target_with(uint32_t from, Component_ID id) {
+			if (from == NO_ARCHETYPE) {
+				Signature signature;
+				return find_or_create(signature.set(id));
+			}
+			uint32_t& edge = archetypes[from]->add_edge[id];
+			if (edge == NO_ARCHETYPE) {
+				Signature signature = archetypes[from]->signature;
+				const uint32_t target = find_or_create(signature.set(id));	// 可能扩容 archetypes，edge 引用仍指向同一个 Archetype
+				edge = target;
+				archetypes[target]->remove_edge[id] = from;
+			}
+			return edge;
+		}
+
+		uint32_t target_without(uint32_t from, Component_ID id) {
+			ArchetypeT& source = *archetypes[from];
+			if (source.signature.count() == 1) return NO_ARCHETYPE;
+			if (source.remove_edge[id] == NO_ARCHETYPE) {
+				Signature signature = source.signature;
+				const uint32_t target = find_or_create(signature.reset(id));
+				archetypes[from]->remove_edge[id] = target;
+				archetypes[target]->add_edge[id] = from;
+			}
+			return archetypes[from]->remove_edge[id];
+		}
+
+		// 行已经搬空 (各列已析构或移走)，用最后一行补洞
+		void erase_row(ArchetypeT& archetype, size_t row) noexcept {
+			const size_t last = archetype.count - 1;
+			if (row != last) {
+				for (uint8_t col = 0; col < archetype.columns.size(); ++col) {
+					infos[archetype.columns[col].id].relocate(archetype.slot(row, col), archetype.slot(last, col));
+					archetype.changed_at(row, col) = archetype.changed_at(last, col);
+					archetype.added_at(row, col) = archetype.added_at(last, col);
+				}
+				const Entity moved = archetype.entity_at(last);
+				archetype.entity_at(row) = moved;
+				locations[moved.index()].row = static_cast<uint32_t>(row);
+			}
+			--archetype.count;
+			archetype.trim();
+		}
+
+		// 把实体整行搬到 target：两边共有的组件移过去，只在源端的析构，只在目标端的留给调用方构造
+		// 返回在 target 中的行号 (target 为 NO_ARCHETYPE 时实体不再占行)
+		size_t migrate(Entity entity, uint32_t target) {
+			Location& location = locations[entity.index()];
+			size_t row = 0;
+			if (target != NO_ARCHETYPE) row = archetypes[target]->push_row(entity);
+
+			if (location.archetype != NO_ARCHETYPE) {
+				ArchetypeT& source = *archetypes[location.archetype];
+				const size_t from = location.row;
+				for (uint8_t col = 0; col < source.columns.size(); ++col) {
+					const Component_ID id = source.columns[col].id;
+					if (target != NO_ARCHETYPE && archetypes[target]->has_column(id)) {
+						ArchetypeT& dest = *archetypes[target];
+						const uint8_t to = dest.column_of[id];
+						infos[id].relocate(dest.slot(row, to), source.slot(from, col));
+						dest.changed_at(row, to) = source.changed_at(from, col);
+						dest.added_at(row, to) = source.added_at(from, col);
+					}
+					else {
+						infos[id].destroy(source.slot(from, col));
+					}
+				}
+				erase_row(source, from);
+			}
+
+			location = { target, static_cast<uint32_t>(row) };
+			return row;
+		}
+
+		template<typename T>
+		[[nodiscard]] T& component_at(const Location& location, Component_ID id) const noexcept {
+			const ArchetypeT& archetype = *archetypes[location.archetype];
+			return *std::launder(static_cast<T*>(archetype.slot(location.row, archetype.column_of[id])));
+		}
+
+		void touch(Component_ID id) noexcept { storages[id]->touch(current_tick); }
+
+	public:
+		BasicArchetypeRegistry() = default;
+		BasicArchetypeRegistry(const BasicArchetypeRegistry&) = delete;		// 组件存储门面持有本对象地址
+		BasicArchetypeRegistry& operator=(const BasicArchetypeRegistry&) = delete;
+
+		~BasicArchetypeRegistry() { clear(); }
+
+		template<typename... Components>
+		BasicArchetypeView<Traits, Components...> view() {
+			return BasicArchetypeView<Traits, Components...>(*this);
+		}
+
+		// 组件存储门面 (不存在则创建)：contains / get / last_write，供 ComponentRef 与增量系统使用
+		template<typename T>
+		[[nodiscard]] pool_type<T>& storage() {
+			return static_cast<pool_type<T>&>(*storages[register_component<T>()]);
+		}
+
+		[[nodiscard]] Tick tick() const noexcept { return current_tick; }
+
+		// 推进到下一个 tick (tick 记在块内，无需同步到各组件)
+		Tick advance_tick() noexcept { return ++current_tick; }
+
+		[[nodiscard]] bool is_alive(Entity entity) const noexcept {
+			return entity_pool.is_valid(entity);
+		}
+
+		[[nodiscard]] Entity create_entity() noexcept {
+			Entity entity = entity_pool.acquire();
+			locations.ensure(entity_pool.high_water());
+			return entity;
+		}
+
+		void create_entities(std::span<Entity> out) {
+			for (Entity& entity : out) {
+				entity = entity_pool.acquire();
+			}
+			locations.ensure(entity_pool.high_water());
+		}
+
+		[[nodiscard]] std::vector<Entity> create_entities(size_t count) {
+			std::vector<Entity> entities(count);
+			create_entities(std::span<Entity>(entities));
+			return entities;
+		}
+
+		template<typename T>
+		[[nodiscard]] bool has(Entity entity) const {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			const uint32_t archetype = locations[entity.index()].archetype;
+			return archetype != NO_ARCHETYPE && archetypes[archetype]->signature[get_component_type_id<T>()];
+		}
+
+		// 挂组件：整行搬到 “当前签名 + T” 的 Archetype，再原地构造 T；已存在时返回现有组件
+		template<typename T, typename... Args>
+		requires std::constructible_from<T, Args...>
+		[[nodiscard]] T& emplace(Entity entity, Args&&... args) {
+			assert(is_alive(entity));
+			const Component_ID id = register_component<T>();
+			const Location location = locations[entity.index()];
+			if (location.archetype != NO_ARCHETYPE && archetypes[location.archetype]->has_column(id)) {
+				return get<T>(entity);
+			}
+
+			const uint32_t target = target_with(location.archetype, id);
+			const size_t row = migrate(entity, target);
+			ArchetypeT& archetype = *archetypes[target];
+			const uint8_t col = archetype.column_of[id];
+			T* component = ::new (archetype.slot(row, col)) T(std::forward<Args>(args)...);
+			archetype.changed_at(row, col) = current_tick;
+			archetype.added_at(row, col) = current_tick;
+			touch(id);
+			return *component;
+		}
+
+		// 批量挂组件：与 emplace 一致，已有该组件的实体保持原值
+		template<typename T>
+		void emplace_many(std::span<const Entity> entities, std::span<const T> values) {
+			assert(entities.size() == values.size() && "emplace_many size mismatch!");
+			for (size_t i : std::views::iota(size_t{ 0 }, entities.size())) {
+				(void)emplace<T>(entities[i], values[i]);
+			}
+		}
+
+		template<typename T>
+		void emplace_many(std::span<const Entity> entities, const T& value) {
+			for (Entity entity : entities) (void)emplace<T>(entity, value);
+		}
+
+		// 可写访问：记下 changed tick
+		template<typename T>
+		[[nodiscard]] T& get(Entity entity) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			assert(has<T>(entity) && "Entity does not have component! Use try_get() for safe access.");
+			const Component_ID id = get_component_type_id<T>();
+			const Location& location = locations[entity.index()];
+			ArchetypeT& archetype = *archetypes[location.archetype];
+			archetype.changed_at(location.row, archetype.column_of[id]) = current_tick;
+			touch(id);
+			return component_at<T>(location, id);
+		}
+
+		// 只读路径：不记录修改
+		template<typename T>
+		[[nodiscard]] const T& get(Entity entity) const {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			assert(has<T>(entity) && "Entity does not have component! Use try_get() for safe access.");
+			return component_at<T>(locations[entity.index()], get_component_type_id<T>());
+		}
+
+		template<typename T>
+		[[nodiscard]] std::optional<std::reference_wrapper<T>> try_get(Entity entity) noexcept {
+			if (!is_alive(entity) || !has<T>(entity)) return std::nullopt;
+			return std::ref(get<T>(entity));
+		}
+
+		template<typename T>
+		[[nodiscard]] std::optional<std::reference_wrapper<const T>> try_get(Entity entity) const noexcept {
+			if (!is_alive(entity) || !has<T>(entity)) return std::nullopt;
+			return std::cref(get<T>(entity));
+		}
+
+		// 删组件：整行搬到 “当前签名 - T” 的 Archetype
+		template<typename T>
+		void remove(Entity entity) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			if (!has<T>(entity)) return;
+			const Component_ID id = get_component_type_id<T>();
+			touch(id);
+			migrate(entity, target_without(locations[entity.index()].archetype, id));
+		}
+
+		void destroy_entity(Entity entity) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			const uint32_t archetype = locations[entity.index()].archetype;
+			if (archetype != NO_ARCHETYPE) {
+				for (const auto& column : archetypes[archetype]->columns) touch(column.id);
+				migrate(entity, NO_ARCHETYPE);
+			}
+			entity_pool.release(entity.index());
+		}
+
+		void destroy_entities(std::span<const Entity> entities) {
+			for (Entity entity : entities) {
+				destroy_entity(entity);
+			}
+		}
+
+		[[nodiscard]] size_t size() const {
+			return entity_pool.size();
+		}
+
+		// 保留 Archetype 结构 (与边缓存)，释放全部行与块
+		void clear() {
+			for (auto& archetype : archetypes) {
+				for (size_t row = 0; row < archetype->count; ++row) {
+					for (uint8_t col = 0; col < archetype->columns.size(); ++col) {
+						infos[archetype->columns[col].id].destroy(archetype->slot(row, col));
+					}
+				}
+				archetype->count = 0;
+				archetype->chunks.clear();
+			}
+			for (Component_ID id = 0; id < MAX_COMPONENTS; ++id) {
+				if (storages[id] != nullptr) touch(id);
+			}
+			locations.reset(Location{});
+			entity_pool.clear();
+		}
+
+		// 统计：Archetype 数、已分配块数与字节数
+		[[nodiscard]] size_t archetype_count() const noexcept { return archetypes.size(); }
+
+		[[nodiscard]] size_t chunk_count() const noexcept {
+			size_t total = 0;
+			for (const auto& archetype : archetypes) total += archetype->chunks.size();
+			return total;
+		}
+
+		[[nodiscard]] size_t chunk_bytes() const noexcept {
+			size_t total = 0;
+			for (const auto& archetype : archetypes) total += archetype->memory_bytes();
+			return total;
+		}
+	};
+
+	// =========================================================================
+	// 单个组件的存储门面：让按 “组件池” 编写的代码 (ComponentRef、增量系统) 在 Archetype 后端上照常工作
+	// 地址稳定 (由 Registry 持有)，本身不存数据
+	// =========================================================================
+	template<typename T, typename Traits>
+	class ArchetypeStorage : public IArchetypeStorage {
+	public:
+		using value_type = T;
+		using Entity = BasicEntity<Traits>;
+
+		explicit ArchetypeStorage(BasicArchetypeRegistry<Traits>& registry) noexcept : reg(&registry) {}
+
+		[[nodiscard]] bool contains(Entity entity) const {
+			return reg->is_alive(entity) && reg->template has<T>(entity);
+		}
+		[[nodiscard]] bool has(Entity entity) const { return contains(entity); }
+
+		[[nodiscard]] T& get(Entity entity) { return reg->template get<T>(entity); }
+		[[nodiscard]] const T& get(Entity entity) const { return std::as_const(*reg).template get<T>(entity); }
+
+		// Lua 字段 setter：与 ColumnSet::set_field 同名
+		template<typename M>
+		void set_field(Entity entity, M T::* member, const M& value) {
+			get(entity).*member = value;
+		}
+
+		[[nodiscard]] Tick changed_tick(Entity entity) const { return tick_of(entity, &ArchetypeT::changed_at); }
+		[[nodiscard]] Tick added_tick(Entity entity) const { return tick_of(entity, &ArchetypeT::added_at); }
+
+		// 挂有 T 的实体总数 (遍历所有含 T 的 Archetype)
+		[[nodiscard]] size_t size() const noexcept {
+			const Component_ID id = get_component_type_id<T>();
+			size_t total = 0;
+			for (const auto& archetype : reg->archetypes) {
+				if (archetype->signature[id]) total += archetype->count;
+			}
+			return total;
+		}
+
+	private:
+		using ArchetypeT = Archetype<Traits>;
+		BasicArchetypeRegistry<Traits>* reg;
+
+		[[nodiscard]] Tick tick_of(Entity entity, Tick& (ArchetypeT::* column)(size_t, uint8_t) const noexcept) const {
+			assert(contains(entity) && "Entity does not have this component!");
+			const auto& location = reg->locations[entity.index()];
+			const ArchetypeT& archetype = *reg->archetypes[location.archetype];
+			return (archetype.*column)(location.row, archetype.column_of[get_component_type_id<T>()]);
+		}
+	};
+
+	// =========================================================================
+	// Archetype 后端的 View：只访问签名包含全部组件的 Archetype，逐块、逐行线性遍历
+	// 接口与 BasicView 相同 (each / par_each / changed_since / added_since / 结构化绑定)
+	// 额外提供 each_chunk：整块交出各列的 span，便于批量处理
+	// =========================================================================
+	template<typename Traits, typename... Components>
+	class BasicArchetypeView {
+	public:
+		using Entity = BasicEntity<Traits>;
+
+	private:
+		using Registry = BasicArchetypeRegistry<Traits>;
+		using ArchetypeT = Archetype<Traits>;
+		static constexpr size_t COUNT = sizeof...(Components);
+
+		Registry& reg;
+		std::array<Component_ID, COUNT> ids;
+		Signature required_signature;
+
+		// 变更过滤：掩码内任一组件的 tick >= since 才通过 (掩码为空表示不过滤)
+		Signature changed_filter;
+		Signature added_filter;
+		Tick changed_since_tick = 0;
+		Tick added_since_tick = 0;
+
+		template<typename C>
+		static constexpr bool in_view = (std::is_same_v<std::remove_const_t<C>, std::remove_const_t<Components>> || ...);
+
+		static constexpr bool writes_any = (!std::is_const_v<Components> || ...);
+
+	public:
+		explicit BasicArchetypeView(Registry& r)
+			: reg(r), ids{ r.template register_component<std::remove_const_t<Components>>()... } {
+			RINN_PROFILE_ZONE("ArchetypeView::construct");
+			for (Component_ID id : ids) required_signature.set(id);
+		}
+
+		template<typename... C>
+		BasicArchetypeView& changed_since(Tick tick) {
+			changed_filter = filter_mask<C...>();
+			changed_since_tick = tick;
+			return *this;
+		}
+
+		template<typename... C>
+		BasicArchetypeView& added_since(Tick tick) {
+			added_filter = filter_mask<C...>();
+			added_since_tick = tick;
+			return *this;
+		}
+
+		// 回调式遍历：func(Entity, Components&...)
+		template<typename Func>
+		requires std::invocable<Func&, Entity, Components&...>
+		void each(Func&& func) const {
+			for (const auto& archetype : reg.archetypes) {
+				if (!matches(*archetype)) continue;
+				for (size_t chunk = 0; chunk < archetype->chunk_count(); ++chunk) {
+					run_chunk(*archetype, chunk, func, std::index_sequence_for<Components...>{});
+				}
+			}
+		}
+
+		// 并行遍历：以块为单位分发，grain 按行数折算成块数
+		template<typename Func>
+		requires std::invocable<Func&, Entity, Components&...>
+		void par_each(JobSystem& jobs, Func&& func, size_t grain = JobSystem::DEFAULT_GRAIN) const {
+			for (const auto& archetype : reg.archetypes) {
+				if (!matches(*archetype)) continue;
+				const ArchetypeT& current = *archetype;
+				jobs.parallel_for(current.chunk_count(), std::max<size_t>(1, grain / current.chunk_capacity), [&](size_t begin, size_t end) {
+					for (size_t chunk = begin; chunk < end; ++chunk) {
+						run_chunk(current, chunk, func, std::index_sequence_for<Components...>{});
+					}
+					});
+			}
+		}
+
+		// 整块遍历：func(std::span<const Entity>, std::span<Components>...)，每块一次调用
+		// 不支持变更过滤；可写组件整块记为修改
+		template<typename Func>
+		requires std::invocable<Func&, std::span<const Entity>, std::span<Components>...>
+		void each_chunk(Func&& func) const {
+			assert(changed_filter.none() && added_filter.none() && "each_chunk does not apply change filters!");
+			for (const auto& archetype : reg.archetypes) {
+				if (!matches(*archetype)) continue;
+				for (size_t chunk = 0; chunk < archetype->chunk_count(); ++chunk) {
+					const size_t rows = archetype->rows_in(chunk);
+					stamp_chunk(*archetype, chunk, rows, std::index_sequence_for<Components...>{});
+					func(std::span<const Entity>(archetype->entities(chunk), rows),
+						std::span<Components>(archetype->template column<std::remove_const_t<Components>>(chunk, archetype->column_of[id_of<Components>()]), rows)...);
+				}
+			}
+		}
+
+		struct viewIterator {
+			const BasicArchetypeView* view;
+			size_t archetype;
+			size_t row;
+
+			viewIterator(const BasicArchetypeView& v, size_t a) : view(&v), archetype(a), row(0) {
+				settle();
+			}
+
+			viewIterator& operator++() {
+				++row;
+				settle();
+				return *this;
+			}
+
+			bool operator!=(const viewIterator& other) const {
+				return archetype != other.archetype || row != other.row;
+			}
+
+			// 支持结构化绑定：for (auto [e, t, s] : view)
+			std::tuple<Entity, Components&...> operator*() const {
+				const ArchetypeT& current = *view->reg.archetypes[archetype];
+				return { current.entity_at(row), view->template fetch<Components>(current, row)... };
+			}
+
+		private:
+			// 停在下一个合法行上；越过最后一个 Archetype 即为 end
+			void settle() {
+				const auto& archetypes = view->reg.archetypes;
+				while (archetype < archetypes.size()) {
+					const ArchetypeT& current = *archetypes[archetype];
+					if (view->matches(current)) {
+						while (row < current.count && !view->passes(current, row)) ++row;
+						if (row < current.count) return;
+					}
+					++archetype;
+					row = 0;
+				}
+			}
+		};
+
+		auto begin() const { return viewIterator(*this, 0); }
+		auto end() const { return viewIterator(*this, reg.archetypes.size()); }
+
+	private:
+		template<typename C>
+		[[nodiscard]] Component_ID id_of() const noexcept {
+			constexpr size_t index = [] {
+				size_t i = 0;
+				((std::is_same_v<C, Components> ? false : (++i, true)) && ...);
+				return i;
+			}();
+			return ids[index];
+		}
+
+		[[nodiscard]] bool matches(const ArchetypeT& archetype) const noexcept {
+			return archetype.count != 0 && (archetype.signature & required_signature) == required_signature;
+		}
+
+		// 变更过滤：只在设置了 changed_since / added_since 时才会真正检查
+		[[nodiscard]] bool passes(const ArchetypeT& archetype, size_t row) const noexcept {
+			if (changed_filter.none() && added_filter.none()) return true;
+			bool changed = changed_filter.none();
+			bool added = added_filter.none();
+			for (Component_ID id : ids) {
+				const uint8_t col = archetype.column_of[id];
+				if (changed_filter[id] && archetype.changed_at(row, col) >= changed_since_tick) changed = true;
+				if (added_filter[id] && archetype.added_at(row, col) >= added_since_tick) added = true;
+			}
+			return changed && added;
+		}
+
+		// const 组件只读；非 const 组件记下 changed tick
+		template<typename C>
+		[[nodiscard]] C& fetch(const ArchetypeT& archetype, size_t row) const {
+			const Component_ID id = id_of<C>();
+			const uint8_t col = archetype.column_of[id];
+			if constexpr (!std::is_const_v<C>) {
+				archetype.changed_at(row, col) = reg.current_tick;
+				reg.storages[id]->touch(reg.current_tick);
+			}
+			return *std::launder(static_cast<C*>(archetype.slot(row, col)));
+		}
+
+		template<typename Func, size_t... I>
+		void run_chunk(const ArchetypeT& archetype, size_t chunk, Func& func, std::index_sequence<I...>) const {
+			const size_t rows = archetype.rows_in(chunk);
+			const std::array<uint8_t, COUNT> cols{ archetype.column_of[ids[I]]... };
+			const Entity* entities = archetype.entities(chunk);
+			const std::tuple<Components*...> data(archetype.template column<std::remove_const_t<Components>>(chunk, cols[I])...);
+
+			if (changed_filter.none() && added_filter.none()) {
+				stamp_chunk(archetype, chunk, rows, std::index_sequence<I...>{});
+				for (size_t i = 0; i < rows; ++i) {
+					func(entities[i], std::get<I>(data)[i]...);
+				}
+				return;
+			}
+
+			const size_t first = chunk * archetype.chunk_capacity;
+			for (size_t i = 0; i < rows; ++i) {
+				if (!passes(archetype, first + i)) continue;
+				if constexpr (writes_any) {
+					((std::is_const_v<Components> ? void() : void(archetype.changed_ticks(chunk, cols[I])[i] = reg.current_tick)), ...);
+				}
+				func(entities[i], std::get<I>(data)[i]...);
+			}
+			if constexpr (writes_any) touch_writes(std::index_sequence<I...>{});
+		}
+
+		// 线性遍历按可写访问整块标记 (与 Group::each 相同)
+		template<size_t... I>
+		void stamp_chunk(const ArchetypeT& archetype, size_t chunk, size_t rows, std::index_sequence<I...>) const {
+			if constexpr (writes_any) {
+				([&] {
+					if constexpr (!std::is_const_v<Components>) {
+						Tick* ticks = archetype.changed_ticks(chunk, archetype.column_of[ids[I]]);
+						std::fill(ticks, ticks + rows, reg.current_tick);
+					}
+					}(), ...);
+				touch_writes(std::index_sequence<I...>{});
+			}
+		}
+
+		template<size_t... I>
+		void touch_writes(std::index_sequence<I...>) const {
+			((std::is_const_v<Components> ? void() : reg.storages[ids[I]]->touch(reg.current_tick)), ...);
+		}
+
+		template<typename... C>
+		[[nodiscard]] Signature filter_mask() const {
+			static_assert((in_view<C> && ...), "Change filter component must be part of the view!");
+			if constexpr (sizeof...(C) == 0) return required_signature;
+			else {
+				Signature mask;
+				(mask.set(get_component_type_id<std::remove_const_t<C>>()), ...);
+				return mask;
+			}
+		}
+	};
+
+	template<typename... Components>
+	using ArchetypeView = BasicArchetypeView<DefaultEntityTraits, Components...>;
+
+	using ArchetypeRegistry = BasicArchetypeRegistry<>;
+}
@@ -0,0 +1,155 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+// =========================================================================
+// 二进制读写流 (Registry 快照用)
+// -------------------------------------------------------------------------
+// - 标量按原样 memcpy；数组按 “数据块” 写：先对齐到 SNAPSHOT_BLOCK_ALIGN，再整块拷贝
+// - 读端的数据块直接指向底层缓冲 (通常是内存映射的文件)，不拷贝，由池整块 assign
+// - 不处理字节序：快照只在同一平台、同一构建之间交换
+// =========================================================================
+namespace Rinn {
+
+	// 块对齐：文件按页映射，块内地址可以直接当 T* 读 (alignof(T) 不超过 64)
+	inline constexpr size_t SNAPSHOT_BLOCK_ALIGN = 64;
+
+	class BinaryWriter {
+	public:
+		void reserve(size_t bytes) { buffer.reserve(bytes); }
+
+		template<typename T>
+		requires std::is_trivially_copyable_v<T>
+		void write(const T& value) {
+			write_bytes(&value, sizeof(T));
+		}
+
+		template<typename T>
+		requires std::is_trivially_copyable_v<T>
+		void write_block(std::span<const T> values) {
+			static_assert(alignof(T) <= SNAPSHOT_BLOCK_ALIGN, "Block element is over-aligned!");
+			buffer.resize((buffer.size() + SNAPSHOT_BLOCK_ALIGN - 1) & ~(SNAPSHOT_BLOCK_ALIGN - 1));
+			write_bytes(values.data(), values.size_bytes());
+		}
+
+		void write_bytes(const void* data, size_t size) {
+			if (size == 0) return;
+			const size_t offset = buffer.size();
+			buffer.resize(offset + size);
+			std::memcpy(buffer.data() + offset, data, size);
+		}
+
+		[[nodiscard]] std::span<const std::byte> bytes() const noexcept { return buffer; }
+		void clear() noexcept { buffer.clear(); }
+
+	private:
+		std::vector<std::byte> buffer;
+	};
+
+	// 越界读取不会崩溃：置失败标记并返回零值 / 空块，调用方读完后检查 ok()
+	// 底层缓冲的首地址须按 SNAPSHOT_BLOCK_ALIGN 对齐 (mmap 的页首地址、AlignedBuffer 都满足)
+	class BinaryReader {
+	public:
+		explicit BinaryReader(std::span<const std::byte> data) noexcept : data(data) {}
+
+		template<typename T>
+		requires std::is_trivially_copyable_v<T> && std::default_initializable<T>
+		[[nodiscard]] T read() {
+			T value{};
+			read_bytes(&value, sizeof(T));
+			return value;
+		}
+
+		void read_bytes(void* out, size_t size) {
+			if (failed || data.size() - offset < size) {
+				failed = true;
+				std::memset(out, 0, size);
+				return;
+			}
+			std::memcpy(out, data.data() + offset, size);
+			offset += size;
+		}
+
+		// 数据块：返回指向底层缓冲的视图
+		template<typename T>
+		requires std::is_trivially_copyable_v<T>
+		[[nodiscard]] std::span<const T> read_block(size_t count) {
+			offset = std::min(data.size(), (offset + SNAPSHOT_BLOCK_ALIGN - 1) & ~(SNAPSHOT_BLOCK_ALIGN - 1));
+			if (failed || count > (data.size() - offset) / sizeof(T)) {
+				failed = true;
+				return {};
+			}
+			const std::byte* ptr = data.data() + offset;
+			assert(reinterpret_cast<uintptr_t>(ptr) % alignof(T) == 0 && "Snapshot block is misaligned!");
+			offset += count * sizeof(T);
+			return { reinterpret_cast<const T*>(ptr), count };
+		}
+
+		[[nodiscard]] bool ok() const noexcept { return !failed; }
+		void fail() noexcept { failed = true; }
+		[[nodiscard]] size_t position() const noexcept { return offset; }
+
+	private:
+		std::span<const std::byte> data;
+		size_t offset = 0;
+		bool failed = false;
+	};
+
+	// 非平凡可复制组件的快照钩子，特化后提供：
+	//   static void save(BinaryWriter&, const T&);
+	//   static T load(BinaryReader&);
+	template<typename T>
+	struct SnapshotTraits;
+
+	template<typename T>
+	concept has_snapshot_traits = requires(BinaryWriter& out, BinaryReader& in, const T& value) {
+		SnapshotTraits<T>::save(out, value);
+		{ SnapshotTraits<T>::load(in) } -> std::same_as<T>;
+	};
+
+	// 平凡可复制的组件整块读写，其余走 SnapshotTraits
+	template<typename T>
+	concept snapshot_serializable = std::is_trivially_copyable_v<T> || has_snapshot_traits<T>;
+
+	// 池布局：元素 (列式池是每一列) 的 sizeof / alignof
+	// 每个池的数据前先写一份，载入时与当前构建的类型逐项比较：组件改了字段 / 对齐的旧快照直接拒绝，而不是按新布局误读
+	struct BlockLayout {
+		uint32_t size;
+		uint32_t align;
+
+		friend bool operator==(const BlockLayout&, const BlockLayout&) = default;
+	};
+
+	template<typename T>
+	[[nodiscard]] constexpr BlockLayout layout_of() noexcept {
+		return { static_cast<uint32_t>(sizeof(T)), static_cast<uint32_t>(alignof(T)) };
+	}
+
+	// { 项数, BlockLayout... }
+	inline void write_layout(BinaryWriter& out, std::span<const BlockLayout> layouts) {
+		out.write(static_cast<uint32_t>(layouts.size()));
+		for (const BlockLayout& layout : layouts) out.write(layout);
+	}
+
+	// 不一致时置失败标记并返回 false
+	[[nodiscard]] inline bool read_layout(BinaryReader& in, std::span<const BlockLayout> expected) {
+		if (in.read<uint32_t>() != expected.size()) {
+			in.fail();
+			return false;
+		}
+		for (const BlockLayout& layout : expected) {
+			if (in.read<BlockLayout>() != layout) {
+				in.fail();
+				return false;
+			}
+		}
+		return in.ok();
+	}
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace Rinn {
+
+	// =========================================================================
+	// 组件存储策略 (按组件类型声明)
+	// -------------------------------------------------------------------------
+	// 默认 AoS：SparseSet<T> 的 Dense 是 std::vector<T>；空类型自动走 TagSet (见 tag_storage)
+	// 需要按字段分列 (SoA) 的组件，在组件定义旁特化 ColumnLayout (按需选用，引擎内置组件都是行式)：
+	//   struct Particle { float x, y; int layer; };
+	//   template<> struct ColumnLayout<Particle> : Columns<&Particle::x, &Particle::y, &Particle::layer> {};
+	// 列式组件必须是聚合体，Columns 必须列出全部字段 (ColumnSet 里 static_assert 检查字段数)
+	// 代价：没有 T&，View 里只读 (按值)，try_get 不可用，写入走 Group::column / Registry::get 返回的行代理
+	// =========================================================================
+	template<typename T>
+	struct ColumnLayout {
+		using columns = void;
+		static constexpr bool enabled = false;
+	};
+
+	template<auto... Members>
+	struct Columns {
+		using columns = Columns;	// 特化通过继承拿到，ColumnSet 据此展开字段列表
+		static constexpr bool enabled = true;
+		static constexpr size_t count = sizeof...(Members);
+	};
+
+	template<typename T>
+	concept column_storage = ColumnLayout<std::remove_const_t<T>>::enabled;
+
+	// 空类型 (IsStatic / Selected 之类的标记组件) 自动走 TagSet：只存实体，没有组件数组
+	template<typename T>
+	concept tag_storage = std::is_empty_v<std::remove_const_t<T>> && !column_storage<T>;
+
+	// 成员指针 -> 字段类型 / 所属类型
+	template<typename> struct member_pointer_traits;
+	template<typename C, typename M>
+	struct member_pointer_traits<M C::*> {
+		using class_type = C;
+		using member_type = M;
+	};
+
+	template<auto Member>
+	using member_type_t = typename member_pointer_traits<decltype(Member)>::member_type;
+
+	template<auto Member>
+	using member_class_t = typename member_pointer_traits<decltype(Member)>::class_type;
+
+	// 聚合体的字段数：能用 N 个 “可转换为任意类型” 的占位值花括号初始化的最大 N
+	namespace detail {
+		template<typename T>
+		struct any_field {
+			template<typename U>
+			requires (!std::is_same_v<U, T>)
+			operator U() const;
+		};
+
+		template<typename T, typename Seq>
+		struct brace_initializable;
+
+		template<typename T, size_t... I>
+		struct brace_initializable<T, std::index_sequence<I...>> {
+			static constexpr bool value = requires { T{ ((void)I, any_field<T>{})... }; };
+		};
+	}
+
+	template<typename T, size_t N = 0>
+	consteval size_t aggregate_field_count() {
+		if constexpr (detail::brace_initializable<T, std::make_index_sequence<N + 1>>::value) return aggregate_field_count<T, N + 1>();
+		else return N;
+	}
+}
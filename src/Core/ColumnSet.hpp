@@ -0,0 +1,390 @@
+#pragma once
+#include "SparseSet.hpp"
+#include "TagSet.hpp"
+#include "ColumnLayout.hpp"
+#include <memory_resource>
+#include <new>
+#include <tuple>
+
+namespace Rinn {
+
+	// 按 Align 字节对齐分配 (默认 64：一条缓存行，SIMD 加载不跨行)，内存来自 memory_resource
+	template<typename T, size_t Align = 64>
+	struct AlignedAllocator {
+		using value_type = T;
+
+		template<typename U>
+		struct rebind { using other = AlignedAllocator<U, Align>; };
+
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource();
+
+		AlignedAllocator() noexcept = default;
+		AlignedAllocator(std::pmr::memory_resource* resource) noexcept : resource(resource) {}
+		template<typename U>
+		AlignedAllocator(const AlignedAllocator<U, Align>& other) noexcept : resource(other.resource) {}
+
+		[[nodiscard]] T* allocate(size_t n) {
+			return static_cast<T*>(resource->allocate(n * sizeof(T), Align));
+		}
+		void deallocate(T* ptr, size_t n) noexcept {
+			resource->deallocate(ptr, n * sizeof(T), Align);
+		}
+
+		template<typename U>
+		bool operator==(const AlignedAllocator<U, Align>& other) const noexcept { return resource == other.resource; }
+	};
+
+	template<typename T>
+	using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+
+	template<typename T, typename Traits, typename Layout = typename ColumnLayout<T>::columns>
+	class ColumnSet;
+
+	// =========================================================================
+	// 列式组件池 (SoA)
+	// -------------------------------------------------------------------------
+	// - 与 SparseSet 相同的稀疏映射、swap-and-pop、分组换位与变更 tick
+	// - Dense 拆成每个字段一列 (64 字节对齐)，只读 x/y 的遍历不会把 layer 拖进缓存，编译器也能跨实体向量化
+	// - 没有 T& 可取：整行读写走 load / store / Row 代理，批量处理走 column<&T::x>() 拿 std::span
+	// =========================================================================
+	template<typename T, typename Traits, auto... Members>
+	class ColumnSet<T, Traits, Columns<Members...>> : public ISparseSet<Traits> {
+	private:
+		using Base = ISparseSet<Traits>;
+		using typename Base::Entity;
+		using typename Base::Entity_index;
+		using Base::NULL_COMPONENT_ENTITY;
+		using Base::Sparse;
+		using Base::current_tick;
+		using Base::touch;
+		using Base::sort_order;
+		using typename Base::SnapshotCheck;
+		using Base::restore_sparse;
+
+		static_assert((std::is_same_v<member_class_t<Members>, T> && ...), "Column member must belong to the component!");
+		static_assert(std::is_default_constructible_v<T>, "Column component must be default constructible!");
+		static_assert(std::is_aggregate_v<T>, "Column component must be an aggregate!");
+		// 未列出的字段按行读写时会被悄悄丢掉
+		static_assert(sizeof...(Members) == aggregate_field_count<T>(), "ColumnLayout must list every field of the component!");
+
+		std::tuple<AlignedVector<member_type_t<Members>>...> columns;
+		std::pmr::vector<Entity> dense_to_entity;
+		std::pmr::vector<Tick> added_ticks;
+		std::pmr::vector<Tick> changed_ticks;
+
+		// 不同类型的成员指针不能直接比较
+		template<auto A, auto B>
+		static constexpr bool same_member = [] {
+			if constexpr (std::is_same_v<decltype(A), decltype(B)>) return A == B;
+			else return false;
+		}();
+
+		template<auto Member>
+		static constexpr bool has_column = (same_member<Member, Members> || ...);
+
+		template<auto Member>
+		static constexpr size_t column_index = [] {
+			size_t index = 0, i = 0;
+			((same_member<Member, Members> ? index = i : 0, ++i), ...);
+			return index;
+		}();
+
+		void write_row(size_t index, const T& value) {
+			((column<Members>(index) = value.*Members), ...);
+		}
+
+		template<auto Member>
+		[[nodiscard]] member_type_t<Member>& column(size_t index) noexcept {
+			return std::get<column_index<Member>>(columns)[index];
+		}
+
+	public:
+		using value_type = T;
+
+		explicit ColumnSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: Base(resource), columns(AlignedVector<member_type_t<Members>>(AlignedAllocator<member_type_t<Members>>(resource))...),
+			dense_to_entity(resource), added_ticks(resource), changed_ticks(resource) {}
+
+		// 行代理：Registry::emplace / get 对列式组件返回它
+		class Row {
+		public:
+			Row(ColumnSet& set, size_t index) noexcept : set(&set), index(index) {}
+
+			[[nodiscard]] T load() const { return set->load_at(index); }
+			operator T() const { return load(); }
+
+			Row& operator=(const T& value) {
+				set->write_row(index, value);
+				return *this;
+			}
+
+			// 单字段：row.field<&Particle::x>() += 1.0f
+			template<auto Member>
+			requires (has_column<Member>)
+			[[nodiscard]] member_type_t<Member>& field() const noexcept { return set->template column<Member>(index); }
+
+		private:
+			ColumnSet* set;
+			size_t index;
+		};
+
+		using Base::has;
+
+		template<typename... Args>
+		requires std::constructible_from<T, Args...>
+		Row emplace(Entity entity, Args&&... args) {
+			assert(entity.index() < Traits::MAX_ENTITIES && "Entity out of range!");
+			if (Sparse.get(entity.index()) != NULL_COMPONENT_ENTITY) return get(entity);
+
+			const T value(std::forward<Args>(args)...);
+			(std::get<column_index<Members>>(columns).push_back(value.*Members), ...);
+			push_slot(entity);
+			return Row(*this, size() - 1);
+		}
+
+		void reserve(size_t capacity) {
+			(std::get<column_index<Members>>(columns).reserve(capacity), ...);
+			dense_to_entity.reserve(capacity);
+			added_ticks.reserve(capacity);
+			changed_ticks.reserve(capacity);
+		}
+
+		void reserve_more(size_t count) {
+			const size_t needed = size() + count;
+			if (needed > capacity()) reserve(std::max(needed, capacity() * 2));
+		}
+
+		// 与 emplace 一致：已有组件的实体保持原值
+		void emplace_many(std::span<const Entity> entities, std::span<const T> values) {
+			assert(entities.size() == values.size() && "emplace_many size mismatch!");
+			reserve_more(entities.size());
+			for (size_t i : std::views::iota(size_t{ 0 }, entities.size())) {
+				(void)emplace(entities[i], values[i]);
+			}
+		}
+
+		[[nodiscard]] bool contains(Entity entity) const noexcept {
+			const Entity_index idx = Sparse.get(entity.index());
+			return idx != NULL_COMPONENT_ENTITY && dense_to_entity[idx] == entity;
+		}
+
+		// 可写访问：记下 changed tick，返回行代理
+		[[nodiscard]] Row get(Entity entity) {
+			assert(has(entity) && "Entity does not have this component!");
+			const Entity_index idx = Sparse.get(entity.index());
+			changed_ticks[idx] = current_tick;
+			touch();
+			return Row(*this, idx);
+		}
+
+		// 只读：从各列拼回一个 T (按值)
+		[[nodiscard]] T get(Entity entity) const {
+			assert(has(entity) && "Entity does not have this component!");
+			return load_at(Sparse.get(entity.index()));
+		}
+
+		[[nodiscard]] T load_at(size_t index) const {
+			T value{};
+			((value.*Members = std::get<column_index<Members>>(columns)[index]), ...);
+			return value;
+		}
+
+		void store(Entity entity, const T& value) {
+			(void)get(entity);		// 标记修改
+			write_row(Sparse.get(entity.index()), value);
+		}
+
+		// 按运行期成员指针写单个字段 (Lua 字段 setter)
+		template<typename M>
+		void set_field(Entity entity, M T::* member, const M& value) {
+			const size_t idx = Sparse.get(entity.index());
+			(void)get(entity);
+			const bool written = ([&] {
+				if constexpr (std::is_same_v<decltype(Members), M T::*>) {
+					if (Members == member) {
+						column<Members>(idx) = value;
+						return true;
+					}
+				}
+				return false;
+				}() || ...);
+			assert(written && "Field is not stored in a column!");
+			(void)written;
+		}
+
+		// 整列访问：下标与 dense_to_entity / Group 前缀一致
+		// 可写版本不自动标记修改，写完请配合 mark_changed_range
+		template<auto Member>
+		requires (has_column<Member>)
+		[[nodiscard]] std::span<member_type_t<Member>> column() noexcept {
+			return std::get<column_index<Member>>(columns);
+		}
+
+		template<auto Member>
+		requires (has_column<Member>)
+		[[nodiscard]] std::span<const member_type_t<Member>> column() const noexcept {
+			return std::get<column_index<Member>>(columns);
+		}
+
+		void mark_changed(Entity entity) noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			changed_ticks[Sparse.get(entity.index())] = current_tick;
+			touch();
+		}
+
+		void mark_changed_range(size_t begin, size_t end) noexcept {
+			std::fill(changed_ticks.begin() + begin, changed_ticks.begin() + end, current_tick);
+			touch();
+		}
+
+		[[nodiscard]] Tick added_tick(Entity entity) const noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			return added_ticks[Sparse.get(entity.index())];
+		}
+
+		[[nodiscard]] Tick changed_tick(Entity entity) const noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			return changed_ticks[Sparse.get(entity.index())];
+		}
+
+		// 每列、每个平行数组各自 swap-and-pop
+		void remove(Entity entity) override {
+			const Entity_index index_deleted = Sparse.get(entity.index());
+			if (index_deleted == NULL_COMPONENT_ENTITY) return;
+			touch();
+
+			const size_t index_last = size() - 1;
+			if (index_deleted != index_last) {
+				const Entity entity_last = dense_to_entity[index_last];
+				((column<Members>(index_deleted) = std::move(column<Members>(index_last))), ...);
+				dense_to_entity[index_deleted] = entity_last;
+				added_ticks[index_deleted] = added_ticks[index_last];
+				changed_ticks[index_deleted] = changed_ticks[index_last];
+				Sparse.set(entity_last.index(), index_deleted);
+			}
+			(std::get<column_index<Members>>(columns).pop_back(), ...);
+			dense_to_entity.pop_back();
+			added_ticks.pop_back();
+			changed_ticks.pop_back();
+			Sparse.set(entity.index(), NULL_COMPONENT_ENTITY);
+		}
+
+		void swap_dense(size_t lhs, size_t rhs) override {
+			if (lhs == rhs) return;
+			using std::swap;
+			(swap(column<Members>(lhs), column<Members>(rhs)), ...);
+			swap(dense_to_entity[lhs], dense_to_entity[rhs]);
+			swap(added_ticks[lhs], added_ticks[rhs]);
+			swap(changed_ticks[lhs], changed_ticks[rhs]);
+			Sparse.set(dense_to_entity[lhs].index(), static_cast<Entity_index>(lhs));
+			Sparse.set(dense_to_entity[rhs].index(), static_cast<Entity_index>(rhs));
+		}
+
+		// 原地排序：compare 比较组件 (按行拼出 T) 或实体 (Entity, Entity)，规则同 SparseSet::sort
+		template<typename Compare>
+		void sort(Compare compare) {
+			if constexpr (std::predicate<Compare&, const T&, const T&>) {
+				this->sort_slots([this, &compare](size_t lhs, size_t rhs) { return compare(load_at(lhs), load_at(rhs)); });
+			}
+			else {
+				static_assert(std::predicate<Compare&, Entity, Entity>, "Comparator must take (const T&, const T&) or (Entity, Entity)!");
+				this->sort_slots([this, &compare](size_t lhs, size_t rhs) { return compare(dense_to_entity[lhs], dense_to_entity[rhs]); });
+			}
+		}
+
+		void clear() override {
+			for (Entity e : dense_to_entity) {
+				Sparse.set(e.index(), NULL_COMPONENT_ENTITY);
+			}
+			(std::get<column_index<Members>>(columns).clear(), ...);
+			dense_to_entity.clear();
+			added_ticks.clear();
+			changed_ticks.clear();
+			touch();
+		}
+
+		[[nodiscard]] size_t size() const noexcept override {
+			return dense_to_entity.size();
+		}
+
+		[[nodiscard]] size_t capacity() const noexcept override {
+			return dense_to_entity.capacity();
+		}
+
+		[[nodiscard]] size_t dense_bytes() const noexcept override {
+			return ((std::get<column_index<Members>>(columns).capacity() * sizeof(member_type_t<Members>)) + ... + 0)
+				+ dense_to_entity.capacity() * sizeof(Entity) + (added_ticks.capacity() + changed_ticks.capacity()) * sizeof(Tick)
+				+ sort_order.capacity() * sizeof(Entity_index);
+		}
+
+		[[nodiscard]] uint64_t type_key() const noexcept override { return get_component_type_key<T>(); }
+		// 列只能整块读写：每一列的类型都必须平凡可复制 (列式组件不走 SnapshotTraits)
+		static constexpr bool trivial_columns = (std::is_trivially_copyable_v<member_type_t<Members>> && ...);
+		[[nodiscard]] bool serializable() const noexcept override { return trivial_columns; }
+
+		// 布局记录逐列一项，然后每列一个数据块
+		static constexpr std::array<BlockLayout, sizeof...(Members)> LAYOUT{ layout_of<member_type_t<Members>>()... };
+
+		void save(BinaryWriter& out) const override {
+			if constexpr (trivial_columns) {
+				write_layout(out, LAYOUT);
+				out.write_block(std::span<const Entity>(dense_to_entity));
+				out.write_block(std::span<const Tick>(added_ticks));
+				out.write_block(std::span<const Tick>(changed_ticks));
+				(out.write_block(std::span<const member_type_t<Members>>(std::get<column_index<Members>>(columns))), ...);
+			}
+			else {
+				assert(false && "Column component has a column that is not trivially copyable!");
+			}
+		}
+
+		[[nodiscard]] bool load(BinaryReader& in, size_t count, const SnapshotCheck& accept) override {
+			if constexpr (!trivial_columns) {
+				in.fail();
+				return false;
+			}
+			else {
+				assert(size() == 0 && "Snapshot must be loaded into an empty pool!");
+				if (!read_layout(in, LAYOUT)) return false;
+				const std::span<const Entity> entities = in.template read_block<Entity>(count);
+				const std::span<const Tick> added = in.template read_block<Tick>(count);
+				const std::span<const Tick> changed = in.template read_block<Tick>(count);
+				const std::tuple<std::span<const member_type_t<Members>>...> values{ in.template read_block<member_type_t<Members>>(count)... };
+				if (!in.ok() || !restore_sparse(entities, accept)) return false;
+
+				(std::get<column_index<Members>>(columns).assign(std::get<column_index<Members>>(values).begin(), std::get<column_index<Members>>(values).end()), ...);
+				dense_to_entity.assign(entities.begin(), entities.end());
+				added_ticks.assign(added.begin(), added.end());
+				changed_ticks.assign(changed.begin(), changed.end());
+				touch();
+				return true;
+			}
+		}
+
+		void shrink_to(size_t capacity) override {
+			(shrink_capacity(std::get<column_index<Members>>(columns), capacity), ...);
+			shrink_capacity(dense_to_entity, capacity);
+			shrink_capacity(added_ticks, capacity);
+			shrink_capacity(changed_ticks, capacity);
+			shrink_capacity(sort_order, 0);
+		}
+
+		[[nodiscard]] const Entity* entity_data() const noexcept override {
+			return dense_to_entity.data();
+		}
+
+	private:
+		void push_slot(Entity entity) {
+			dense_to_entity.push_back(entity);
+			added_ticks.push_back(current_tick);
+			changed_ticks.push_back(current_tick);
+			Sparse.set(entity.index(), static_cast<Entity_index>(size() - 1));
+			touch();
+		}
+	};
+
+	// 组件 T 在 Registry 中的存储类型：空类型走 TagSet，声明了 ColumnLayout 的走列式，其余走 SparseSet
+	template<typename T, typename Traits>
+	using storage_for_t = std::conditional_t<tag_storage<T>, TagSet<T, Traits>,
+		std::conditional_t<column_storage<T>, ColumnSet<T, Traits>, SparseSet<T, Traits>>>;
+}
@@ -0,0 +1,273 @@
+#pragma once
+#include "Registry.hpp"
+#include "JobSystem.hpp"
+#include <cstddef>
+#include <new>
+#include <span>
+
+namespace Rinn {
+
+	// 延迟创建的实体：flush 时才分配真实句柄，只在创建它的那个命令缓冲里有效
+	struct PendingEntity {
+		uint32_t slot = 0;
+	};
+
+	// =========================================================================
+	// 延迟命令缓冲 (Command Buffer)
+	// -------------------------------------------------------------------------
+	// - 遍历 View / 工作线程中不能直接改 Registry (swap-and-pop 会让迭代失效，也不是线程安全的)
+	// - 这里只记录 create / emplace / remove / destroy (以及组件修改后的 notify_update)，flush 时统一批量应用：
+	//     1. 按顺序创建所有延迟实体，解析出真实句柄
+	//     2. emplace / remove 按 (组件 ID, 实体索引, 记录序号) 排序后逐池应用 (同一池连续写，缓存友好)
+	//        同一实体同一组件上的多条命令保持记录顺序 (用序号代替 stable_sort，后者每次 flush 都要申请临时缓冲)
+	//     3. 最后统一销毁 (去重，跳过已失效的句柄)
+	// - 命令是紧凑的 POD 记录；组件参数原地构造在分块字节缓冲里，块不搬家，支持非平凡类型
+	// =========================================================================
+	template<typename Traits = DefaultEntityTraits>
+	class BasicCommandBuffer {
+	public:
+		using Registry = BasicRegistry<Traits>;
+		using Entity = BasicEntity<Traits>;
+
+		BasicCommandBuffer() = default;
+		BasicCommandBuffer(const BasicCommandBuffer&) = delete;
+		BasicCommandBuffer& operator=(const BasicCommandBuffer&) = delete;
+		BasicCommandBuffer(BasicCommandBuffer&&) noexcept = default;
+		BasicCommandBuffer& operator=(BasicCommandBuffer&&) = delete;
+
+		~BasicCommandBuffer() {
+			discard();
+		}
+
+		// 记录创建，返回延迟句柄
+		[[nodiscard]] PendingEntity create() {
+			return PendingEntity{ pending_count++ };
+		}
+
+		template<typename T, typename... Args>
+		requires std::constructible_from<T, Args...>
+		void emplace(Entity entity, Args&&... args) {
+			record_emplace<T>(Target{ entity.id, false }, std::forward<Args>(args)...);
+		}
+
+		template<typename T, typename... Args>
+		requires std::constructible_from<T, Args...>
+		void emplace(PendingEntity entity, Args&&... args) {
+			assert(entity.slot < pending_count && "PendingEntity belongs to another command buffer!");
+			record_emplace<T>(Target{ entity.slot, true }, std::forward<Args>(args)...);
+		}
+
+		template<typename T>
+		void remove(Entity entity) {
+			commands.push_back({ Target{ entity.id, false }, Op::Remove, get_component_type_id<T>(), next_sequence(), nullptr, &ops_for<T> });
+		}
+
+		// 组件已在系统里原地修改：flush 时发 on_update<T> (Registry 的信号只能在主线程发)
+		template<typename T>
+		void notify_update(Entity entity) {
+			commands.push_back({ Target{ entity.id, false }, Op::Update, get_component_type_id<T>(), next_sequence(), nullptr, &ops_for<T> });
+		}
+
+		void destroy(Entity entity) {
+			destroys.push_back(entity);
+		}
+
+		[[nodiscard]] bool empty() const noexcept {
+			return pending_count == 0 && commands.empty() && destroys.empty();
+		}
+
+		[[nodiscard]] size_t command_count() const noexcept {
+			return pending_count + commands.size() + destroys.size();
+		}
+
+		// 上一次 flush 中延迟实体解析出的真实句柄 (下标 = PendingEntity::slot)
+		[[nodiscard]] std::span<const Entity> created() const noexcept { return resolved; }
+
+		// 统一应用到 Registry，之后缓冲清空可复用 (内存保留)
+		void flush(Registry& registry) {
+			// 1. 创建
+			resolved.resize(pending_count);
+			for (Entity& entity : resolved) {
+				entity = registry.create_entity();
+			}
+
+			// 2. 解析目标并按 (组件池, 实体) 稳定排序
+			for (Command& cmd : commands) {
+				if (cmd.target.pending) {
+					cmd.target = Target{ resolved[static_cast<size_t>(cmd.target.value)].id, false };
+				}
+			}
+			std::ranges::sort(commands, [](const Command& a, const Command& b) {
+				if (a.component != b.component) return a.component < b.component;
+				const uint64_t lhs = a.target.value & Entity::INDEX_MASK;
+				const uint64_t rhs = b.target.value & Entity::INDEX_MASK;
+				if (lhs != rhs) return lhs < rhs;
+				return a.sequence < b.sequence;
+				});
+
+			for (Command& cmd : commands) {
+				Entity entity;
+				entity.id = static_cast<typename Entity::storage_type>(cmd.target.value);
+				if (cmd.op == Op::Emplace) {
+					if (registry.is_alive(entity)) cmd.ops->emplace(registry, entity, cmd.payload);
+					else cmd.ops->destroy_payload(cmd.payload);
+					cmd.payload = nullptr;
+				}
+				else if (!registry.is_alive(entity)) {
+					continue;
+				}
+				else if (cmd.op == Op::Remove) {
+					cmd.ops->remove(registry, entity);
+				}
+				else {
+					cmd.ops->update(registry, entity);
+				}
+			}
+			commands.clear();
+
+			// 3. 销毁：按索引排序去重
+			std::ranges::sort(destroys, {}, [](Entity e) { return e.id; });
+			const auto [first, last] = std::ranges::unique(destroys);
+			destroys.erase(first, last);
+			for (Entity entity : destroys) {
+				if (registry.is_alive(entity)) registry.destroy_entity(entity);
+			}
+			destroys.clear();
+
+			pending_count = 0;
+			reset_arena();
+		}
+
+		// 丢弃所有未应用的命令
+		void discard() {
+			for (Command& cmd : commands) {
+				if (cmd.payload) cmd.ops->destroy_payload(cmd.payload);
+			}
+			commands.clear();
+			destroys.clear();
+			pending_count = 0;
+			reset_arena();
+		}
+
+	private:
+		enum class Op : uint8_t { Emplace, Remove, Update };
+
+		// 目标：真实句柄，或延迟实体槽位
+		struct Target {
+			uint64_t value = 0;
+			bool pending = false;
+		};
+
+		// 每种组件一张静态函数表，命令只存指针
+		struct ComponentOps {
+			void (*emplace)(Registry&, Entity, void*);
+			void (*remove)(Registry&, Entity);
+			void (*update)(Registry&, Entity);
+			void (*destroy_payload)(void*);
+		};
+
+		template<typename T>
+		static constexpr ComponentOps ops_for{
+			[](Registry& reg, Entity e, void* payload) {
+				T& value = *std::launder(static_cast<T*>(payload));
+				(void)reg.template emplace<T>(e, std::move(value));
+				value.~T();
+			},
+			[](Registry& reg, Entity e) { reg.template remove<T>(e); },
+			[](Registry& reg, Entity e) {
+				if constexpr (!tag_storage<T>) {
+					if (reg.template has<T>(e)) reg.template notify_update<T>(e);		// 之后的命令可能已把组件移除
+				}
+			},
+			[](void* payload) { std::launder(static_cast<T*>(payload))->~T(); },
+		};
+
+		struct Command {
+			Target target;
+			Op op;
+			Component_ID component;
+			uint32_t sequence;				// 记录顺序，排序时保持同一目标上的命令先后
+			void* payload;					// Emplace：参数区里原地构造好的组件
+			const ComponentOps* ops;
+		};
+
+		std::vector<Command> commands;
+		std::vector<Entity> destroys;
+
+		[[nodiscard]] uint32_t next_sequence() const noexcept { return static_cast<uint32_t>(commands.size()); }
+		std::vector<Entity> resolved;
+		uint32_t pending_count = 0;
+
+		// 分块参数区：块一旦分配就不移动，已构造对象的地址稳定
+		static constexpr size_t BLOCK_SIZE = 16 * 1024;
+		std::vector<std::unique_ptr<std::byte[]>> blocks;
+		size_t block_index = 0;
+		size_t block_offset = 0;
+		std::vector<std::unique_ptr<std::byte[]>> oversized;	// 超过一块的组件单独分配
+
+		void* allocate(size_t size, size_t align) {
+			if (size + align > BLOCK_SIZE) {
+				oversized.push_back(std::make_unique<std::byte[]>(size + align));
+				void* ptr = oversized.back().get();
+				size_t space = size + align;
+				return std::align(align, size, ptr, space);
+			}
+			while (true) {
+				if (block_index == blocks.size()) {
+					blocks.push_back(std::make_unique<std::byte[]>(BLOCK_SIZE));
+				}
+				void* ptr = blocks[block_index].get() + block_offset;
+				size_t space = BLOCK_SIZE - block_offset;
+				if (std::align(align, size, ptr, space)) {
+					block_offset = BLOCK_SIZE - space + size;
+					return ptr;
+				}
+				++block_index;
+				block_offset = 0;
+			}
+		}
+
+		void reset_arena() {
+			block_index = 0;
+			block_offset = 0;
+			oversized.clear();
+		}
+
+		template<typename T, typename... Args>
+		void record_emplace(Target target, Args&&... args) {
+			void* payload = allocate(sizeof(T), alignof(T));
+			::new (payload) T(std::forward<Args>(args)...);
+			commands.push_back({ target, Op::Emplace, get_component_type_id<T>(), next_sequence(), payload, &ops_for<T> });
+		}
+	};
+
+	// =========================================================================
+	// 每线程一条命令缓冲：工作线程各写各的，无锁；flush 按线程编号顺序逐条应用
+	// =========================================================================
+	template<typename Traits = DefaultEntityTraits>
+	class BasicCommandBuffers {
+	public:
+		using Registry = BasicRegistry<Traits>;
+
+		explicit BasicCommandBuffers(JobSystem& jobs) : jobs(jobs), buffers(jobs.thread_count()) {}
+
+		// 当前线程专属的命令缓冲
+		[[nodiscard]] BasicCommandBuffer<Traits>& local() {
+			return buffers[jobs.current_thread_index()];
+		}
+
+		// 统一应用点：只能在没有系统并行运行时调用
+		void flush(Registry& registry) {
+			for (BasicCommandBuffer<Traits>& buffer : buffers) {
+				if (!buffer.empty()) buffer.flush(registry);
+			}
+		}
+
+	private:
+		JobSystem& jobs;
+		std::vector<BasicCommandBuffer<Traits>> buffers;
+	};
+
+	using CommandBuffer = BasicCommandBuffer<>;
+	using CommandBuffers = BasicCommandBuffers<>;
+}
@@ -1,6 +1,9 @@
 #pragma once
 #include "Types.hpp"
 #include <atomic>  // 添加这个
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 // 1. 内部计数器：记录当前发到第几号了
 // 这是一个普通的类，只存一个静态整数
@@ -13,10 +16,34 @@ struct ComponentCounter {
 template <typename T>
 Component_ID get_component_type_id() {
 
-    // 静态初始化只有第一次会执行，之后遇到都会跳过
-    // ComponentID.hpp 中的原子操作
-    static Component_ID id = ComponentCounter::counter.fetch_add(1, std::memory_order_relaxed);
-    return id;
+    // const Transform / Transform& 与 Transform 共用同一个 ID
+    if constexpr (!std::is_same_v<T, std::remove_cvref_t<T>>) {
+        return get_component_type_id<std::remove_cvref_t<T>>();
+    }
+    else {
+        // 静态初始化只有第一次会执行，之后遇到都会跳过
+        // ComponentID.hpp 中的原子操作
+        static Component_ID id = ComponentCounter::counter.fetch_add(1, std::memory_order_relaxed);
+        return id;
+    }
 }
 
-// 组件ID和Components_pool中组件池的位置以及签名位置一致对应
\ No newline at end of file
+// 组件ID和Components_pool中组件池的位置以及签名位置一致对应
+
+
+// 3. 跨进程稳定的类型标识：类型名的 FNV-1a 哈希
+// 组件 ID 按首次使用顺序分配，每次运行可能不同；快照用它匹配组件池 (同一编译器下稳定)
+template <typename T>
+constexpr std::uint64_t get_component_type_key() {
+#if defined(_MSC_VER)
+    constexpr std::string_view name = __FUNCSIG__;
+#else
+    constexpr std::string_view name = __PRETTY_FUNCTION__;
+#endif
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : name) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
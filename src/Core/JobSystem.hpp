@@ -0,0 +1,231 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+#include <string>
+#include "Profiler.hpp"
+
+namespace Rinn {
+
+	// =========================================================================
+	// 工作窃取线程池 (Work-Stealing Job System)
+	// -------------------------------------------------------------------------
+	// - 每个线程一条双端队列：自己从尾部 LIFO 取 (热缓存)，小偷从头部 FIFO 偷 (大块)
+	// - 调用线程 (主线程) 也是一条队列，等待期间会帮忙执行任务，不会空等
+	// - Job 是 “函数指针 + 上下文 + 参数” 三元组，提交任务零堆分配 (队列容量预热后不再增长)
+	// =========================================================================
+	class JobSystem {
+	public:
+		// 默认粒度：每块 1024 个元素，足够摊薄调度开销
+		static constexpr size_t DEFAULT_GRAIN = 1024;
+
+		struct Job {
+			void (*invoke)(void* context, size_t arg) = nullptr;
+			void* context = nullptr;
+			size_t arg = 0;
+		};
+
+		// worker_count 不含调用线程；默认 = 硬件线程数 - 1
+		explicit JobSystem(size_t worker_count = default_worker_count()) {
+			queues.reserve(worker_count + 1);
+			for (size_t i = 0; i < worker_count + 1; ++i) {
+				queues.push_back(std::make_unique<WorkQueue>());
+			}
+			workers.reserve(worker_count);
+			for (size_t i = 1; i <= worker_count; ++i) {
+				workers.emplace_back([this, i] { worker_loop(i); });
+			}
+		}
+
+		~JobSystem() {
+			stopping.store(true, std::memory_order_release);
+			signal.fetch_add(1, std::memory_order_release);
+			signal.notify_all();
+			for (std::thread& worker : workers) {
+				worker.join();
+			}
+		}
+
+		JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		[[nodiscard]] static size_t default_worker_count() noexcept {
+			const unsigned hw = std::thread::hardware_concurrency();
+			return hw > 1 ? hw - 1 : 0;
+		}
+
+		// 参与执行的线程总数 (工作线程 + 调用线程)
+		[[nodiscard]] size_t thread_count() const noexcept { return workers.size() + 1; }
+
+		// 当前线程在本线程池中的编号：0 = 外部线程 (主线程)，1..N = 工作线程
+		[[nodiscard]] size_t current_thread_index() const noexcept {
+			return tls_owner == this ? tls_index : 0;
+		}
+
+		// 当前线程是否是某个线程池的工作线程 (调用 run_one 的外部线程不算)
+		[[nodiscard]] static bool on_worker_thread() noexcept { return tls_owner != nullptr; }
+
+		// 提交单个任务到当前线程的队列
+		void submit(Job job) {
+			submit_batch(&job, 1);
+		}
+
+		// 批量提交：一次加锁，一次唤醒
+		void submit_batch(const Job* jobs, size_t count) {
+			if (count == 0) return;
+			queues[current_thread_index()]->push(jobs, count);
+			signal.fetch_add(1, std::memory_order_release);
+			if (count == 1) signal.notify_one();
+			else signal.notify_all();
+		}
+
+		// 尝试执行一个任务 (先自己的队列，再去别人那里偷)，没有任务时返回 false
+		bool run_one() {
+			Job job;
+			if (!find_job(current_thread_index(), job)) return false;
+			job.invoke(job.context, job.arg);
+			return true;
+		}
+
+		// 帮忙干活直到计数器归零 (计数器由任务自己递减)
+		void wait(const std::atomic<size_t>& remaining) {
+			while (remaining.load(std::memory_order_acquire) != 0) {
+				if (!run_one()) std::this_thread::yield();
+			}
+		}
+
+		// 并行区间：[0, count) 按 grain 切成固定块，func(begin, end) 处理一块
+		// 切块只取决于 count 与 grain，与线程数和调度顺序无关 (确定性切块)
+		template<typename Func>
+		void parallel_for(size_t count, size_t grain, Func&& func) {
+			if (count == 0) return;
+			grain = std::max<size_t>(grain, 1);
+			const size_t chunks = (count + grain - 1) / grain;
+
+			// 只有一块或没有工作线程：直接在调用线程执行
+			if (chunks == 1 || workers.empty()) {
+				for (size_t begin = 0; begin < count; begin += grain) {
+					func(begin, std::min(begin + grain, count));
+				}
+				return;
+			}
+
+			struct ForContext {
+				Func* func;
+				size_t count;
+				size_t grain;
+				std::atomic<size_t> remaining;
+			};
+			ForContext context{ &func, count, grain, chunks };
+
+			constexpr auto invoke = [](void* raw, size_t chunk) {
+				ForContext& ctx = *static_cast<ForContext*>(raw);
+				const size_t begin = chunk * ctx.grain;
+				(*ctx.func)(begin, std::min(begin + ctx.grain, ctx.count));
+				ctx.remaining.fetch_sub(1, std::memory_order_acq_rel);
+			};
+
+			// 第 0 块留给自己，其余分批入队给小偷 (栈上缓冲，不分配)
+			std::array<Job, 64> batch;
+			size_t batched = 0;
+			for (size_t chunk = 1; chunk < chunks; ++chunk) {
+				batch[batched++] = { invoke, &context, chunk };
+				if (batched == batch.size() || chunk + 1 == chunks) {
+					submit_batch(batch.data(), batched);
+					batched = 0;
+				}
+			}
+
+			invoke(&context, 0);
+			wait(context.remaining);
+		}
+
+	private:
+		// 加锁环形双端队列：竞争只发生在偷窃时，锁持有时间只有几次下标运算
+		// 容量按 2 的幂翻倍且从不收缩，稳态下入队出队都不分配 (std::deque 会反复申请 / 释放节点)
+		class WorkQueue {
+			std::mutex mutex;
+			std::vector<Job> ring = std::vector<Job>(64);
+			size_t head = 0;		// 队头：小偷从这里偷
+			size_t count = 0;
+
+			[[nodiscard]] size_t mask() const noexcept { return ring.size() - 1; }
+
+			void grow() {
+				std::vector<Job> bigger(ring.size() * 2);
+				for (size_t i = 0; i < count; ++i) bigger[i] = ring[(head + i) & mask()];
+				ring.swap(bigger);
+				head = 0;
+			}
+		public:
+			void push(const Job* batch, size_t n) {
+				std::scoped_lock lock(mutex);
+				while (count + n > ring.size()) grow();
+				for (size_t i = 0; i < n; ++i) ring[(head + count + i) & mask()] = batch[i];
+				count += n;
+			}
+			bool pop_back(Job& out) {
+				std::scoped_lock lock(mutex);
+				if (count == 0) return false;
+				out = ring[(head + --count) & mask()];
+				return true;
+			}
+			bool steal_front(Job& out) {
+				std::scoped_lock lock(mutex);
+				if (count == 0) return false;
+				out = ring[head];
+				head = (head + 1) & mask();
+				--count;
+				return true;
+			}
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> queues;		// [0] = 外部线程，[1..N] = 工作线程
+		std::vector<std::thread> workers;
+		std::atomic<bool> stopping{ false };
+		std::atomic<uint32_t> signal{ 0 };					// 每次提交 +1，空闲线程在此 wait
+
+		static inline thread_local const JobSystem* tls_owner = nullptr;
+		static inline thread_local size_t tls_index = 0;
+
+		bool find_job(size_t self, Job& out) {
+			if (queues[self]->pop_back(out)) return true;
+			// 从右邻居开始轮询偷窃，避免所有小偷挤在同一条队列
+			for (size_t offset = 1; offset < queues.size(); ++offset) {
+				if (queues[(self + offset) % queues.size()]->steal_front(out)) return true;
+			}
+			return false;
+		}
+
+		void worker_loop(size_t index) {
+			tls_owner = this;
+			tls_index = index;
+			RINN_PROFILE_THREAD("worker " + std::to_string(index));
+			while (true) {
+				// 先记下信号值再找任务：找不到时 wait 会因期间的新提交立即返回，不会丢失唤醒
+				const uint32_t seen = signal.load(std::memory_order_acquire);
+				Job job;
+				if (find_job(index, job)) {
+					job.invoke(job.context, job.arg);
+					continue;
+				}
+				if (stopping.load(std::memory_order_acquire)) return;
+				signal.wait(seen, std::memory_order_acquire);
+			}
+		}
+	};
+
+	// 通用并行遍历：对随机访问区间的每个元素调用 func(element)
+	template<std::random_access_iterator It, typename Func>
+	void par_for_each(JobSystem& jobs, It first, It last, Func&& func, size_t grain = JobSystem::DEFAULT_GRAIN) {
+		jobs.parallel_for(static_cast<size_t>(std::distance(first, last)), grain, [&](size_t begin, size_t end) {
+			std::for_each(first + begin, first + end, func);
+			});
+	}
+}
@@ -0,0 +1,211 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// =========================================================================
+// ECS 内存资源
+// -------------------------------------------------------------------------
+// - AlignedBuffer：一整块按缓存行 / 大页对齐的内存
+// - StorageArena：组件存储用的预分配区，Registry reg(&arena) 后所有组件池都从这里分配
+// - FrameArena：帧内临时内存 (查询结果、排序缓冲等)，原子指针碰撞分配，每帧 reset 一次性回收
+// 稳态帧 (预热之后) 的目标是零堆分配：各处缓冲都复用容量，临时内存只从 FrameArena 取
+// =========================================================================
+namespace Rinn {
+
+	inline constexpr size_t CACHE_LINE_SIZE = 64;
+	inline constexpr size_t HUGE_PAGE_SIZE = size_t{ 2 } << 20;		// 2MB：x86-64 透明大页
+
+	// 不小于 2MB 的块按大页对齐，操作系统可以直接用大页映射，减少 TLB 缺失
+	[[nodiscard]] constexpr size_t page_alignment_for(size_t size) noexcept {
+		return size >= HUGE_PAGE_SIZE ? HUGE_PAGE_SIZE : CACHE_LINE_SIZE;
+	}
+
+	// 对齐的大块内存 (只可移动)
+	class AlignedBuffer {
+	public:
+		AlignedBuffer() = default;
+		explicit AlignedBuffer(size_t size, size_t align = 0)
+			: memory(static_cast<std::byte*>(::operator new(size, std::align_val_t{ align ? align : page_alignment_for(size) })),
+				Deleter{ align ? align : page_alignment_for(size) }), length(size) {}
+
+		[[nodiscard]] std::byte* data() const noexcept { return memory.get(); }
+		[[nodiscard]] size_t size() const noexcept { return length; }
+
+	private:
+		struct Deleter {
+			size_t align = CACHE_LINE_SIZE;
+			void operator()(std::byte* ptr) const noexcept { ::operator delete(ptr, std::align_val_t{ align }); }
+		};
+
+		std::unique_ptr<std::byte[], Deleter> memory;
+		size_t length = 0;
+	};
+
+	// =========================================================================
+	// 组件存储预分配区
+	// -------------------------------------------------------------------------
+	// 大页对齐的整块内存 -> monotonic (顺序切分)，其上分两路：
+	// - 小块 (<= POOL_LIMIT，池对象、稀疏页等)：unsynchronized_pool 按尺寸分级复用
+	// - 大块 (稠密数组、页表)：按 2 的幂分级，归还后挂进该级的空闲链表，下次同级申请直接复用
+	//   monotonic 的 deallocate 是空操作：大块若直接交给它，扩容 / compact 换下的旧数组永远拿不回来
+	// - 用尽后向 upstream 申请；arena 析构时整体释放
+	// - 非线程安全：与 Registry 的结构性修改一样只在单线程 (命令缓冲 flush) 中发生
+	// - Registry 必须先于 arena 析构
+	// =========================================================================
+	class StorageArena final : public std::pmr::memory_resource {
+	public:
+		static constexpr size_t POOL_LIMIT = size_t{ 16 } << 10;
+
+		explicit StorageArena(size_t capacity, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+			: buffer(capacity), monotonic(buffer.data(), buffer.size(), upstream),
+			pool(std::pmr::pool_options{ 0, POOL_LIMIT }, &monotonic) {}
+
+		StorageArena(const StorageArena&) = delete;
+		StorageArena& operator=(const StorageArena&) = delete;
+
+		[[nodiscard]] size_t capacity() const noexcept { return buffer.size(); }
+
+		// 大块：当前借出 / 曾经从 monotonic 切出的字节数 (按分级后的尺寸计)
+		[[nodiscard]] size_t large_bytes_in_use() const noexcept { return large_in_use; }
+		[[nodiscard]] size_t large_bytes_reserved() const noexcept { return large_reserved; }
+
+	private:
+		// 空闲大块的链表节点直接放在块内 (块至少 POOL_LIMIT 字节)，归还 / 复用都不分配
+		struct FreeBlock {
+			FreeBlock* next;
+		};
+
+		AlignedBuffer buffer;
+		std::pmr::monotonic_buffer_resource monotonic;
+		std::pmr::unsynchronized_pool_resource pool;
+		std::array<FreeBlock*, 64> free_blocks{};		// 下标：log2(分级尺寸)
+		size_t large_in_use = 0;
+		size_t large_reserved = 0;
+
+		[[nodiscard]] static size_t large_class(size_t bytes) noexcept { return static_cast<size_t>(std::countr_zero(std::bit_ceil(bytes))); }
+		[[nodiscard]] static size_t large_align(size_t align) noexcept { return std::max(align, CACHE_LINE_SIZE); }
+
+		void* do_allocate(size_t bytes, size_t align) override {
+			if (bytes <= POOL_LIMIT) return pool.allocate(bytes, align);
+
+			const size_t cls = large_class(bytes);
+			const size_t size = size_t{ 1 } << cls;
+			large_in_use += size;
+			// 同级块都按缓存行对齐；更严格的对齐请求才需要往后找
+			for (FreeBlock** link = &free_blocks[cls]; *link != nullptr; link = &(*link)->next) {
+				FreeBlock* block = *link;
+				if (reinterpret_cast<uintptr_t>(block) % align == 0) {
+					*link = block->next;
+					return block;
+				}
+			}
+			large_reserved += size;
+			return monotonic.allocate(size, large_align(align));
+		}
+
+		void do_deallocate(void* ptr, size_t bytes, size_t align) override {
+			if (bytes <= POOL_LIMIT) {
+				pool.deallocate(ptr, bytes, align);
+				return;
+			}
+			const size_t cls = large_class(bytes);
+			large_in_use -= size_t{ 1 } << cls;
+			free_blocks[cls] = ::new (ptr) FreeBlock{ free_blocks[cls] };
+		}
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+	};
+
+	// =========================================================================
+	// 帧分配器 (线性分配)
+	// -------------------------------------------------------------------------
+	// - 分配 = 一次原子 CAS 碰撞指针，多个工作线程可同时分配；释放是空操作
+	// - reset() 在帧开始调用 (不能与分配并发)，本帧所有内存一次性作废
+	// - 块用尽时向 upstream 申请 (记为溢出)，reset 时按峰值把块扩大：预热几帧后稳态零分配
+	// 用法：std::pmr::vector<Entity> hits(&scheduler.frame_arena());
+	// =========================================================================
+	class FrameArena final : public std::pmr::memory_resource {
+	public:
+		static constexpr size_t DEFAULT_CAPACITY = size_t{ 1 } << 20;
+
+		explicit FrameArena(size_t capacity = DEFAULT_CAPACITY, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+			: block(capacity), upstream(upstream) {}
+
+		FrameArena(const FrameArena&) = delete;
+		FrameArena& operator=(const FrameArena&) = delete;
+
+		~FrameArena() override { release_overflow(); }
+
+		// 回收本帧全部内存；上一帧溢出过则把块扩大到峰值 (只在这里重新分配)
+		void reset() {
+			const size_t demand = head.load(std::memory_order_relaxed) + overflow_total;
+			peak_bytes = std::max(peak_bytes, demand);
+			if (overflow_total != 0) {
+				block = AlignedBuffer(std::bit_ceil(demand));
+			}
+			release_overflow();
+			head.store(0, std::memory_order_relaxed);
+		}
+
+		[[nodiscard]] size_t used() const noexcept { return std::min(head.load(std::memory_order_relaxed), block.size()) + overflow_total; }
+		[[nodiscard]] size_t capacity() const noexcept { return block.size(); }
+		[[nodiscard]] size_t peak() const noexcept { return std::max(peak_bytes, used()); }
+		[[nodiscard]] size_t overflow_count() const noexcept { return overflow.size(); }
+
+	private:
+		struct Overflow {
+			void* ptr;
+			size_t bytes;
+			size_t align;
+		};
+
+		AlignedBuffer block;
+		std::atomic<size_t> head{ 0 };
+		std::pmr::memory_resource* upstream;
+
+		std::mutex overflow_mutex;
+		std::vector<Overflow> overflow;			// 块放不下的分配，reset 时归还 upstream
+		size_t overflow_total = 0;
+		size_t peak_bytes = 0;
+
+		void* do_allocate(size_t bytes, size_t align) override {
+			const uintptr_t base = reinterpret_cast<uintptr_t>(block.data());
+			size_t offset = head.load(std::memory_order_relaxed);
+			while (true) {
+				const size_t aligned = ((base + offset + align - 1) & ~(uintptr_t{ align } - 1)) - base;
+				if (aligned + bytes > block.size()) return allocate_overflow(bytes, align);
+				if (head.compare_exchange_weak(offset, aligned + bytes, std::memory_order_relaxed)) {
+					return block.data() + aligned;
+				}
+			}
+		}
+
+		void do_deallocate(void*, size_t, size_t) override {}		// 帧末统一回收
+
+		bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+		void* allocate_overflow(size_t bytes, size_t align) {
+			void* ptr = upstream->allocate(bytes, align);
+			std::scoped_lock lock(overflow_mutex);
+			overflow.push_back({ ptr, bytes, align });
+			overflow_total += bytes;
+			return ptr;
+		}
+
+		void release_overflow() noexcept {
+			for (const Overflow& o : overflow) upstream->deallocate(o.ptr, o.bytes, o.align);
+			overflow.clear();
+			overflow_total = 0;
+		}
+	};
+}
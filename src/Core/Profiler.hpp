@@ -0,0 +1,270 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+// =========================================================================
+// 帧分析器 (Profiler)
+// -------------------------------------------------------------------------
+// - RAII 区段：RINN_PROFILE_ZONE("name") 记录本作用域的起止时间
+// - 每个线程一块环形缓冲，只有本线程写：一次拷贝 + 一次 release 递增，无锁；写满后覆盖最旧的记录
+// - 编译期开关：定义 RINN_PROFILE (CMake -DRINN_ENABLE_PROFILER=ON) 时宏才生成代码，否则展开为空
+// - 按需导出 Chrome trace-event JSON (chrome://tracing / Perfetto 打开)，或按区段汇总 p50 / p90 / p99 / max
+// - 区段名必须是字符串字面量或经 intern() 得到的常驻字符串 (缓冲只存指针)
+// =========================================================================
+namespace Rinn {
+
+	struct ProfileEvent {
+		const char* name;
+		uint64_t start_ns;		// 相对 Profiler 创建时刻
+		uint64_t end_ns;
+	};
+
+	// 单写者环形缓冲：写端是所属线程，读端 (导出) 只在帧间调用
+	class ProfileRing {
+	public:
+		static constexpr size_t CAPACITY = size_t{ 1 } << 16;	// 每线程 64K 条，约 1.5MB
+
+		ProfileRing(uint32_t id, std::string name) : events(std::make_unique<ProfileEvent[]>(CAPACITY)), id(id), name(std::move(name)) {}
+
+		void push(const ProfileEvent& event) noexcept {
+			const uint64_t index = head.load(std::memory_order_relaxed);
+			events[index & (CAPACITY - 1)] = event;
+			head.store(index + 1, std::memory_order_release);
+		}
+
+		// 拷出仍在缓冲内的记录 (自上次 clear 起)
+		void snapshot(std::vector<ProfileEvent>& out) const {
+			const uint64_t end = head.load(std::memory_order_acquire);
+			uint64_t begin = std::max(cleared.load(std::memory_order_relaxed), end > CAPACITY ? end - CAPACITY : 0);
+			const size_t first = out.size();
+			for (uint64_t i = begin; i < end; ++i) out.push_back(events[i & (CAPACITY - 1)]);
+
+			// 拷贝期间写端又前进了：被覆盖的最旧几条作废
+			const uint64_t after = head.load(std::memory_order_acquire);
+			if (after > CAPACITY && after - CAPACITY > begin) {
+				const size_t stale = static_cast<size_t>(std::min(after - CAPACITY, end) - begin);
+				out.erase(out.begin() + first, out.begin() + first + stale);
+			}
+		}
+
+		void clear() noexcept { cleared.store(head.load(std::memory_order_acquire), std::memory_order_relaxed); }
+
+		[[nodiscard]] uint32_t thread_id() const noexcept { return id; }
+		[[nodiscard]] const std::string& thread_name() const noexcept { return name; }
+
+	private:
+		std::unique_ptr<ProfileEvent[]> events;
+		std::atomic<uint64_t> head{ 0 };
+		std::atomic<uint64_t> cleared{ 0 };
+		uint32_t id;
+		std::string name;
+	};
+
+	// 单个区段的统计 (毫秒)
+	struct ZoneStats {
+		const char* name;
+		size_t count;
+		double total_ms;
+		double p50_ms;
+		double p90_ms;
+		double p99_ms;
+		double max_ms;
+	};
+
+	class Profiler {
+	public:
+		[[nodiscard]] static Profiler& instance() {
+			static Profiler profiler;
+			return profiler;
+		}
+
+		Profiler(const Profiler&) = delete;
+		Profiler& operator=(const Profiler&) = delete;
+
+		// 运行期开关 (编译期已开启时才有意义)
+		void set_enabled(bool value) noexcept { active.store(value, std::memory_order_relaxed); }
+		[[nodiscard]] bool enabled() const noexcept { return active.load(std::memory_order_relaxed); }
+
+		[[nodiscard]] uint64_t now_ns() const noexcept {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch).count());
+		}
+
+		void record(const char* name, uint64_t start_ns, uint64_t end_ns) {
+			thread_ring().push({ name, start_ns, end_ns });
+		}
+
+		// 帧边界：记录一个从上一次标记到现在的 "frame" 区段，用来找尖刺帧
+		void frame_mark() {
+			const uint64_t now = now_ns();
+			const uint64_t last = last_frame.exchange(now, std::memory_order_relaxed);
+			if (last != 0 && enabled()) record("frame", last, now);
+		}
+
+		// 当前线程在 trace 中显示的名字 (须在该线程首次记录前调用)
+		void set_thread_name(std::string name) { tls_name = std::move(name); }
+
+		// 动态名字 (系统名等) 转为常驻字符串，返回的指针在程序结束前一直有效
+		[[nodiscard]] const char* intern(std::string_view name) {
+			std::scoped_lock lock(mutex);
+			return names.emplace(name).first->c_str();
+		}
+
+		// 丢弃已记录的内容 (各线程缓冲保留)
+		void clear() {
+			std::scoped_lock lock(mutex);
+			for (const auto& ring : rings) ring->clear();
+		}
+
+		// 导出 Chrome trace-event JSON
+		bool write_chrome_trace(const char* path) const {
+			std::FILE* out = std::fopen(path, "w");
+			if (out == nullptr) return false;
+
+			std::scoped_lock lock(mutex);
+			std::fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+			bool first = true;
+			std::vector<ProfileEvent> events;
+			for (const auto& ring : rings) {
+				std::fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":", first ? "" : ",\n", ring->thread_id());
+				write_json_string(out, ring->thread_name());
+				std::fprintf(out, "}}");
+				first = false;
+
+				events.clear();
+				ring->snapshot(events);
+				for (const ProfileEvent& event : events) {
+					std::fprintf(out, ",\n{\"name\":");
+					write_json_string(out, event.name);
+					std::fprintf(out, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+						ring->thread_id(), static_cast<double>(event.start_ns) / 1000.0, static_cast<double>(event.end_ns - event.start_ns) / 1000.0);
+				}
+			}
+			std::fprintf(out, "\n]}\n");
+			return std::fclose(out) == 0;
+		}
+
+		// 按区段名汇总所有线程的记录，按总耗时降序
+		[[nodiscard]] std::vector<ZoneStats> summarize() const {
+			std::vector<ProfileEvent> events;
+			{
+				std::scoped_lock lock(mutex);
+				for (const auto& ring : rings) ring->snapshot(events);
+			}
+			// 同名区段可能来自不同的字符串字面量地址：按内容归并
+			std::ranges::sort(events, [](const ProfileEvent& a, const ProfileEvent& b) {
+				return std::string_view(a.name) < std::string_view(b.name);
+				});
+
+			std::vector<ZoneStats> stats;
+			std::vector<double> durations;
+			for (size_t begin = 0; begin < events.size();) {
+				size_t end = begin;
+				durations.clear();
+				while (end < events.size() && std::string_view(events[end].name) == events[begin].name) {
+					durations.push_back(static_cast<double>(events[end].end_ns - events[end].start_ns) / 1e6);
+					++end;
+				}
+				std::ranges::sort(durations);
+				double total = 0.0;
+				for (double d : durations) total += d;
+				stats.push_back({ events[begin].name, durations.size(), total,
+					percentile(durations, 0.50), percentile(durations, 0.90), percentile(durations, 0.99), durations.back() });
+				begin = end;
+			}
+			std::ranges::sort(stats, [](const ZoneStats& a, const ZoneStats& b) { return a.total_ms > b.total_ms; });
+			return stats;
+		}
+
+		void print_summary(std::FILE* out = stdout) const {
+			std::fprintf(out, "%-32s %8s %10s %9s %9s %9s %9s\n", "zone", "count", "total ms", "p50", "p90", "p99", "max");
+			for (const ZoneStats& s : summarize()) {
+				std::fprintf(out, "%-32s %8zu %10.3f %9.3f %9.3f %9.3f %9.3f\n", s.name, s.count, s.total_ms, s.p50_ms, s.p90_ms, s.p99_ms, s.max_ms);
+			}
+		}
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		Profiler() : epoch(Clock::now()) {}
+
+		Clock::time_point epoch;
+		std::atomic<bool> active{ true };
+		std::atomic<uint64_t> last_frame{ 0 };
+
+		mutable std::mutex mutex;								// 只保护线程注册、intern 与导出，不在记录路径上
+		std::vector<std::unique_ptr<ProfileRing>> rings;		// 线程退出后缓冲仍保留，导出时可见
+		std::unordered_set<std::string> names;
+
+		static inline thread_local ProfileRing* tls_ring = nullptr;
+		static inline thread_local std::string tls_name;
+
+		// 首次记录时注册本线程的缓冲
+		ProfileRing& thread_ring() {
+			if (tls_ring == nullptr) {
+				std::scoped_lock lock(mutex);
+				const uint32_t id = static_cast<uint32_t>(rings.size());
+				rings.push_back(std::make_unique<ProfileRing>(id, tls_name.empty() ? "thread " + std::to_string(id) : tls_name));
+				tls_ring = rings.back().get();
+			}
+			return *tls_ring;
+		}
+
+		[[nodiscard]] static double percentile(const std::vector<double>& sorted, double p) noexcept {
+			const size_t rank = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+			return sorted[rank];
+		}
+
+		static void write_json_string(std::FILE* out, std::string_view text) {
+			std::fputc('"', out);
+			for (const char c : text) {
+				if (c == '"' || c == '\\') std::fputc('\\', out);
+				std::fputc(c, out);
+			}
+			std::fputc('"', out);
+		}
+	};
+
+	// RAII 区段：构造时计时，析构时写入本线程缓冲 (运行期关闭时只有一次原子读)
+	class ProfileZone {
+	public:
+		explicit ProfileZone(const char* name) noexcept
+			: name(name), start(Profiler::instance().enabled() ? Profiler::instance().now_ns() : NOT_RECORDING) {}
+
+		~ProfileZone() {
+			if (start != NOT_RECORDING) {
+				Profiler& profiler = Profiler::instance();
+				profiler.record(name, start, profiler.now_ns());
+			}
+		}
+
+		ProfileZone(const ProfileZone&) = delete;
+		ProfileZone& operator=(const ProfileZone&) = delete;
+
+	private:
+		static constexpr uint64_t NOT_RECORDING = UINT64_MAX;
+		const char* name;
+		uint64_t start;
+	};
+}
+
+#define RINN_PROFILE_CONCAT_IMPL(a, b) a##b
+#define RINN_PROFILE_CONCAT(a, b) RINN_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef RINN_PROFILE
+#define RINN_PROFILE_ZONE(name) const ::Rinn::ProfileZone RINN_PROFILE_CONCAT(rinn_profile_zone_, __LINE__)(name)
+#define RINN_PROFILE_FRAME() ::Rinn::Profiler::instance().frame_mark()
+#define RINN_PROFILE_THREAD(name) ::Rinn::Profiler::instance().set_thread_name(name)
+#else
+#define RINN_PROFILE_ZONE(name) ((void)0)
+#define RINN_PROFILE_FRAME() ((void)0)
+#define RINN_PROFILE_THREAD(name) ((void)0)
+#endif
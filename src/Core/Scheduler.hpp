@@ -0,0 +1,313 @@
+#pragma once
+#include "Registry.hpp"
+#include "JobSystem.hpp"
+#include "CommandBuffer.hpp"
+#include "Profiler.hpp"
+#include "Memory.hpp"
+#include <string>
+#include <functional>
+#include <chrono>
+#include <mutex>
+
+namespace Rinn {
+
+	// =========================================================================
+	// 组件访问声明 (编译期)
+	// -------------------------------------------------------------------------
+	//   const T -> 只读；T -> 读写
+	//   SystemAccess<const Transform, Velocity> : 读 Transform，读写 Velocity
+	// =========================================================================
+	template<typename... Access>
+	struct SystemAccess {
+		// 读集合：所有声明的组件 (写也意味着读)
+		[[nodiscard]] static Signature reads() {
+			Signature sig;
+			(sig.set(get_component_type_id<std::remove_const_t<Access>>()), ...);
+			return sig;
+		}
+
+		// 写集合：非 const 组件
+		[[nodiscard]] static Signature writes() {
+			Signature sig;
+			([&] {
+				if constexpr (!std::is_const_v<Access>) {
+					sig.set(get_component_type_id<Access>());
+				}
+				}(), ...);
+			return sig;
+		}
+	};
+
+	// 系统执行位置
+	enum class SystemThread : uint8_t {
+		Any,		// 任意工作线程
+		Main,		// 必须在调用 run() 的线程 (渲染、窗口、Lua 状态)
+	};
+
+	// =========================================================================
+	// 系统调度器
+	// -------------------------------------------------------------------------
+	// - 每个系统声明读写集合；按注册顺序，后注册的系统依赖于与它冲突的先注册系统
+	//   (写-写、读-写、写-读)，由此得到一张 DAG
+	// - run() 时入度为 0 的系统立即分发，不冲突的系统在工作线程上并发执行
+	// - Main 系统只在调用线程执行；调用线程等待期间也会帮忙执行其他系统
+	// - 所有系统结束后统一 flush 各线程的命令缓冲 (结构性修改的唯一应用点)
+	// - 随后交付本帧累积的组件生命周期事件 (Registry::flush_signals，见 Signal.hpp)
+	// - 每帧开始推进 Registry 的变更 tick，系统可用 changed_since / added_since 只处理变化的实体
+	// - 每帧开始重置帧分配器：系统的临时内存从 frame_arena() 取，稳态帧不碰全局堆
+	// - 每帧记录各系统起止时间，并按 DAG 计算关键路径；开启 RINN_PROFILE 时每个系统也是一个分析区段
+	// =========================================================================
+	template<typename Traits = DefaultEntityTraits>
+	class BasicScheduler {
+	public:
+		using Registry = BasicRegistry<Traits>;
+		using Entity = BasicEntity<Traits>;
+		using SystemFn = std::function<void(Registry&, float)>;
+
+		// 单个系统本帧的计时
+		struct SystemTiming {
+			const std::string* name = nullptr;
+			double start_ms = 0.0;			// 相对 run() 开始
+			double duration_ms = 0.0;
+			size_t thread = 0;				// JobSystem 线程编号，0 = 调用线程
+			bool critical = false;			// 是否位于关键路径
+		};
+
+		BasicScheduler(Registry& registry, JobSystem& jobs, size_t frame_arena_capacity = FrameArena::DEFAULT_CAPACITY)
+			: registry(registry), jobs(jobs), command_buffers(jobs), arena(frame_arena_capacity) {}
+
+		// 系统内的结构性修改 (create / emplace / remove / destroy) 写到当前线程的命令缓冲，帧末统一应用
+		[[nodiscard]] BasicCommandBuffer<Traits>& commands() { return command_buffers.local(); }
+
+		// 本帧的临时内存 (线程安全，下一次 run() 开始时整体作废)
+		[[nodiscard]] FrameArena& frame_arena() noexcept { return arena; }
+
+		// 显式声明访问：scheduler.add<const Transform, Velocity>("move", [](Registry&, float dt) {...})
+		template<typename... Access, typename Fn>
+		requires std::invocable<Fn&, Registry&, float>
+		size_t add(std::string name, Fn&& fn, SystemThread thread = SystemThread::Any) {
+			// 并行执行前建好所有池：get_pool 的延迟创建不是线程安全的
+			((void)registry.template storage<std::remove_const_t<Access>>(), ...);
+
+			const char* zone = Profiler::instance().intern(name);
+			systems.push_back(SystemNode{
+				std::move(name),
+				zone,
+				SystemFn(std::forward<Fn>(fn)),
+				SystemAccess<Access...>::reads(),
+				SystemAccess<Access...>::writes(),
+				thread,
+				});
+			graph_dirty = true;
+			return systems.size() - 1;
+		}
+
+		// 由 view 签名推导访问：fn(Entity, const Transform&, Velocity&) 对应 add_view<const Transform, Velocity>
+		// 需要帧时间时写成 fn(Entity, float dt, const Transform&, Velocity&)
+		template<typename... Access, typename Fn>
+		requires std::invocable<Fn&, Entity, Access&...> || std::invocable<Fn&, Entity, float, Access&...>
+		size_t add_view(std::string name, Fn&& fn, SystemThread thread = SystemThread::Any) {
+			return add<Access...>(std::move(name),
+				[fn = std::forward<Fn>(fn)](Registry& reg, float dt) mutable {
+					if constexpr (std::invocable<Fn&, Entity, Access&...>) {
+						reg.template view<Access...>().each(fn);
+					}
+					else {
+						reg.template view<Access...>().each([&fn, dt](Entity entity, Access&... components) {
+							fn(entity, dt, components...);
+							});
+					}
+				}, thread);
+		}
+
+		// 执行一帧
+		void run(float dt) {
+			RINN_PROFILE_ZONE("Scheduler::run");
+			if (graph_dirty) build_graph();
+
+			frame_start = Clock::now();
+			current_dt = dt;
+			arena.reset();
+			registry.advance_tick();
+			remaining.store(systems.size(), std::memory_order_release);
+			for (SystemNode& node : systems) {
+				node.pending.store(node.dependency_count, std::memory_order_relaxed);
+			}
+
+			for (size_t i = 0; i < systems.size(); ++i) {
+				if (systems[i].dependency_count == 0) dispatch(i);
+			}
+
+			// 调用线程：优先执行 Main 系统，否则帮工作线程干活
+			while (remaining.load(std::memory_order_acquire) != 0) {
+				size_t index;
+				if (pop_main(index)) {
+					execute(index);
+				}
+				else if (!jobs.run_one()) {
+					std::this_thread::yield();
+				}
+			}
+
+			{
+				RINN_PROFILE_ZONE("CommandBuffers::flush");
+				command_buffers.flush(registry);
+			}
+			// 命令缓冲应用的 emplace / remove / destroy 产生的事件，一帧一次交付给批量监听者
+			registry.flush_signals();
+
+			frame_ms = elapsed_ms(Clock::now());
+			compute_critical_path();
+		}
+
+		[[nodiscard]] const std::vector<SystemTiming>& timings() const noexcept { return frame_timings; }
+		[[nodiscard]] const std::vector<size_t>& critical_path() const noexcept { return critical; }
+		[[nodiscard]] double critical_path_ms() const noexcept { return critical_ms; }
+		[[nodiscard]] double last_frame_ms() const noexcept { return frame_ms; }
+		[[nodiscard]] size_t system_count() const noexcept { return systems.size(); }
+
+		// 依赖关系 (调试 / 可视化)：系统 index 直接依赖的前驱
+		[[nodiscard]] const std::vector<size_t>& dependencies(size_t index) const noexcept { return systems[index].predecessors; }
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		struct SystemNode {
+			std::string name;
+			const char* zone = nullptr;		// 分析区段名 (intern 过的常驻字符串)
+			SystemFn fn;
+			Signature reads;
+			Signature writes;
+			SystemThread thread = SystemThread::Any;
+
+			std::vector<size_t> predecessors;
+			std::vector<size_t> successors;
+			size_t dependency_count = 0;
+			std::atomic<size_t> pending{ 0 };
+
+			SystemNode(std::string n, const char* z, SystemFn f, Signature r, Signature w, SystemThread t)
+				: name(std::move(n)), zone(z), fn(std::move(f)), reads(r), writes(w), thread(t) {}
+			SystemNode(SystemNode&& other) noexcept
+				: name(std::move(other.name)), zone(other.zone), fn(std::move(other.fn)), reads(other.reads), writes(other.writes), thread(other.thread),
+				predecessors(std::move(other.predecessors)), successors(std::move(other.successors)), dependency_count(other.dependency_count) {}
+		};
+
+		Registry& registry;
+		JobSystem& jobs;
+		BasicCommandBuffers<Traits> command_buffers;
+		FrameArena arena;
+		std::vector<SystemNode> systems;
+		bool graph_dirty = false;
+
+		// 帧内状态
+		Clock::time_point frame_start;
+		float current_dt = 0.0f;
+		std::atomic<size_t> remaining{ 0 };
+		std::mutex main_mutex;
+		std::vector<size_t> main_ready;		// 已就绪、等待调用线程执行的 Main 系统
+
+		// 帧统计
+		std::vector<SystemTiming> frame_timings;
+		std::vector<size_t> critical;
+		double critical_ms = 0.0;
+		double frame_ms = 0.0;
+		std::vector<double> finish;			// 关键路径计算的暂存，跨帧复用
+		std::vector<size_t> via;
+
+		[[nodiscard]] static bool conflicts(const SystemNode& a, const SystemNode& b) noexcept {
+			return (a.writes & b.reads).any() || (b.writes & a.reads).any();
+		}
+
+		// 注册顺序即拓扑序：只需检查 j < i 的冲突
+		void build_graph() {
+			for (SystemNode& node : systems) {
+				node.predecessors.clear();
+				node.successors.clear();
+			}
+			for (size_t i = 0; i < systems.size(); ++i) {
+				for (size_t j = 0; j < i; ++j) {
+					if (conflicts(systems[j], systems[i])) {
+						systems[i].predecessors.push_back(j);
+						systems[j].successors.push_back(i);
+					}
+				}
+				systems[i].dependency_count = systems[i].predecessors.size();
+			}
+			frame_timings.assign(systems.size(), SystemTiming{});
+			graph_dirty = false;
+		}
+
+		[[nodiscard]] double elapsed_ms(Clock::time_point t) const noexcept {
+			return std::chrono::duration<double, std::milli>(t - frame_start).count();
+		}
+
+		void dispatch(size_t index) {
+			if (systems[index].thread == SystemThread::Main) {
+				std::scoped_lock lock(main_mutex);
+				main_ready.push_back(index);
+				return;
+			}
+			jobs.submit({ [](void* self, size_t i) { static_cast<BasicScheduler*>(self)->execute(i); }, this, index });
+		}
+
+		bool pop_main(size_t& index) {
+			std::scoped_lock lock(main_mutex);
+			if (main_ready.empty()) return false;
+			index = main_ready.back();
+			main_ready.pop_back();
+			return true;
+		}
+
+		void execute(size_t index) {
+			SystemNode& node = systems[index];
+			const auto start = Clock::now();
+			{
+				RINN_PROFILE_ZONE(node.zone);
+				node.fn(registry, current_dt);
+			}
+			const auto stop = Clock::now();
+
+			SystemTiming& timing = frame_timings[index];
+			timing.name = &node.name;
+			timing.start_ms = elapsed_ms(start);
+			timing.duration_ms = std::chrono::duration<double, std::milli>(stop - start).count();
+			timing.thread = jobs.current_thread_index();
+
+			for (size_t next : node.successors) {
+				if (systems[next].pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+					dispatch(next);
+				}
+			}
+			remaining.fetch_sub(1, std::memory_order_acq_rel);
+		}
+
+		// 关键路径：DAG 上耗时之和最大的依赖链
+		void compute_critical_path() {
+			critical.clear();
+			critical_ms = 0.0;
+			if (systems.empty()) return;
+
+			finish.assign(systems.size(), 0.0);
+			via.assign(systems.size(), SIZE_MAX);
+			size_t last = 0;
+			for (size_t i = 0; i < systems.size(); ++i) {
+				double best = 0.0;
+				for (size_t p : systems[i].predecessors) {
+					if (finish[p] > best) { best = finish[p]; via[i] = p; }
+				}
+				finish[i] = best + frame_timings[i].duration_ms;
+				if (finish[i] > finish[last]) last = i;
+				frame_timings[i].critical = false;
+			}
+
+			critical_ms = finish[last];
+			for (size_t i = last; i != SIZE_MAX; i = via[i]) {
+				critical.push_back(i);
+				frame_timings[i].critical = true;
+			}
+			std::ranges::reverse(critical);
+		}
+	};
+
+	using Scheduler = BasicScheduler<>;
+}
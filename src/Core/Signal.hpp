@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+#include <algorithm>
+
+namespace Rinn {
+
+	// =========================================================================
+	// 组件生命周期信号 (construct / update / destroy 各一个)
+	// -------------------------------------------------------------------------
+	// - 即时监听：事件发生时同步回调 fn(Registry&, Entity)
+	//   construct 在组件构造之后，destroy 在组件移除之前 (回调里还能读到组件)
+	// - 批量监听：事件先记到本信号的缓冲里，Registry::flush_signals() 时一次交付 fn(Registry&, span<Entity>)
+	//   调度器每帧在命令缓冲 flush 之后调用，一帧一次调用 (Lua 回调跨语言开销只付一次)
+	//   交付时实体可能已被销毁，回调需要自行 is_alive 检查
+	// - 没有监听者时 Registry 跳过发信号 (一次空指针 / empty 检查)
+	// - 不是线程安全的：construct / destroy 来自结构性修改，本来就只在主线程 (命令缓冲 flush) 发生
+	//   update 来自普通的组件写入，并行系统里要用 CommandBuffer::notify_update 延迟到 flush 再发
+	//   (Registry::patch / notify_update 在工作线程上且有监听时会断言失败)
+	// - 回调里不要连接 / 断开同一个信号，也不要对正在移除的实体做结构性修改，请走 CommandBuffer
+	// =========================================================================
+	template<typename Registry>
+	class LifecycleSignal {
+	public:
+		using Entity = typename Registry::Entity;
+		using Handler = std::function<void(Registry&, Entity)>;
+		using BatchHandler = std::function<void(Registry&, std::span<const Entity>)>;
+		using Connection = uint32_t;
+
+		// 返回连接编号，用于 disconnect
+		Connection connect(Handler fn) {
+			handlers.push_back({ next_id, std::move(fn) });
+			return next_id++;
+		}
+
+		Connection connect_batched(BatchHandler fn) {
+			batch_handlers.push_back({ next_id, std::move(fn) });
+			return next_id++;
+		}
+
+		void disconnect(Connection id) {
+			std::erase_if(handlers, [id](const auto& slot) { return slot.id == id; });
+			std::erase_if(batch_handlers, [id](const auto& slot) { return slot.id == id; });
+			if (batch_handlers.empty()) pending.clear();
+		}
+
+		[[nodiscard]] bool empty() const noexcept { return handlers.empty() && batch_handlers.empty(); }
+		[[nodiscard]] size_t size() const noexcept { return handlers.size() + batch_handlers.size(); }
+		[[nodiscard]] size_t pending_count() const noexcept { return pending.size(); }
+
+		// 以下由 Registry 调用
+		void publish(Registry& reg, Entity entity) {
+			for (auto& slot : handlers) slot.fn(reg, entity);
+			if (!batch_handlers.empty()) pending.push_back(entity);
+		}
+
+		// 交付期间新发生的事件进 pending，留到下一次 flush
+		void flush(Registry& reg) {
+			if (pending.empty()) return;
+			delivering.swap(pending);
+			const std::span<const Entity> batch(delivering);
+			for (auto& slot : batch_handlers) slot.fn(reg, batch);
+			delivering.clear();			// 保留容量，稳态帧不分配
+		}
+
+		// Registry::clear 后缓冲里的句柄全部作废
+		void discard() noexcept { pending.clear(); }
+
+	private:
+		template<typename Fn>
+		struct Slot {
+			Connection id;
+			Fn fn;
+		};
+
+		std::vector<Slot<Handler>> handlers;
+		std::vector<Slot<BatchHandler>> batch_handlers;
+		std::vector<Entity> pending;		// 等待批量交付的实体 (按发生顺序，可能重复)
+		std::vector<Entity> delivering;
+		Connection next_id = 0;
+	};
+}
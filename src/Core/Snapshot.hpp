@@ -0,0 +1,153 @@
+#pragma once
+#include "Registry.hpp"
+#include "BinaryStream.hpp"
+#include "Memory.hpp"
+#include "Profiler.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define RINN_SNAPSHOT_MMAP 1
+#endif
+
+// =========================================================================
+// Registry 二进制快照
+// -------------------------------------------------------------------------
+// 文件 = SnapshotHeader + Registry::save 的数据块
+// - 平凡可复制的组件整块写出；其余组件特化 SnapshotTraits (见 BinaryStream.hpp)
+// - 读取时把整个文件映射进内存，各数组直接从映射区整块拷进组件池
+// - 只在同一平台、同一实体布局之间交换：头部校验句柄宽度、实体上限、组件上限
+// - 每个组件池的数据前带布局记录 (元素或每一列的 sizeof / alignof)，组件布局变了的快照整体拒绝
+// 用法：
+//   save_snapshot(reg, "world.snap");
+//   load_snapshot<Transform, Velocity, Sprite>(reg, "world.snap");	// 组件池须先存在
+// =========================================================================
+namespace Rinn {
+
+	inline constexpr char SNAPSHOT_MAGIC[8] = { 'R', 'I', 'N', 'N', 'S', 'N', 'A', 'P' };
+	inline constexpr uint32_t SNAPSHOT_VERSION = 2;		// 2：池数据前加布局记录
+
+	struct SnapshotHeader {
+		char magic[8];
+		uint32_t version;
+		uint32_t handle_bytes;			// sizeof(Traits::storage_type)
+		uint64_t max_entities;
+		uint32_t max_components;
+		uint32_t reserved;
+
+		template<typename Traits>
+		[[nodiscard]] static SnapshotHeader make() noexcept {
+			SnapshotHeader header{};
+			std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+			header.version = SNAPSHOT_VERSION;
+			header.handle_bytes = sizeof(typename Traits::storage_type);
+			header.max_entities = Traits::MAX_ENTITIES;
+			header.max_components = MAX_COMPONENTS;
+			return header;
+		}
+
+		template<typename Traits>
+		[[nodiscard]] bool compatible() const noexcept {
+			const SnapshotHeader expected = make<Traits>();
+			return std::memcmp(magic, expected.magic, sizeof(magic)) == 0 && version == expected.version &&
+				handle_bytes == expected.handle_bytes && max_entities == expected.max_entities &&
+				max_components == expected.max_components;
+		}
+	};
+
+	// 只读整文件映射；没有 mmap 的平台退化为一次性读入对齐缓冲
+	class MappedFile {
+	public:
+		explicit MappedFile(const char* path) {
+#if defined(RINN_SNAPSHOT_MMAP)
+			const int fd = ::open(path, O_RDONLY);
+			if (fd < 0) return;
+			struct stat info {};
+			if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+				void* mapped = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+				if (mapped != MAP_FAILED) {
+					address = static_cast<const std::byte*>(mapped);
+					length = static_cast<size_t>(info.st_size);
+					::madvise(mapped, length, MADV_SEQUENTIAL);
+				}
+			}
+			::close(fd);
+#else
+			std::FILE* file = std::fopen(path, "rb");
+			if (file == nullptr) return;
+			if (std::fseek(file, 0, SEEK_END) == 0) {
+				const long size = std::ftell(file);
+				if (size > 0 && std::fseek(file, 0, SEEK_SET) == 0) {
+					fallback = AlignedBuffer(static_cast<size_t>(size), CACHE_LINE_SIZE);
+					if (std::fread(fallback.data(), 1, fallback.size(), file) == fallback.size()) {
+						address = fallback.data();
+						length = fallback.size();
+					}
+				}
+			}
+			std::fclose(file);
+#endif
+		}
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		~MappedFile() {
+#if defined(RINN_SNAPSHOT_MMAP)
+			if (address != nullptr) ::munmap(const_cast<std::byte*>(address), length);
+#endif
+		}
+
+		[[nodiscard]] bool is_open() const noexcept { return address != nullptr; }
+		[[nodiscard]] std::span<const std::byte> bytes() const noexcept { return { address, length }; }
+
+	private:
+		const std::byte* address = nullptr;
+		size_t length = 0;
+#if !defined(RINN_SNAPSHOT_MMAP)
+		AlignedBuffer fallback;
+#endif
+	};
+
+	// 先在内存里拼好整个快照，再一次性写入文件
+	template<typename Traits>
+	bool save_snapshot(const BasicRegistry<Traits>& reg, const char* path) {
+		RINN_PROFILE_ZONE("Snapshot::save");
+		BinaryWriter out;
+		out.write(SnapshotHeader::make<Traits>());
+		if (!reg.save(out)) return false;
+
+		std::FILE* file = std::fopen(path, "wb");
+		if (file == nullptr) return false;
+		const std::span<const std::byte> bytes = out.bytes();
+		const bool written = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+		return std::fclose(file) == 0 && written;
+	}
+
+	// 快照里出现的组件池必须已经创建 (组件 ID 与池都是首次使用时才有)
+	template<typename Traits>
+	bool load_snapshot(BasicRegistry<Traits>& reg, const char* path) {
+		RINN_PROFILE_ZONE("Snapshot::load");
+		const MappedFile file(path);
+		if (!file.is_open()) return false;
+
+		BinaryReader in(file.bytes());
+		const SnapshotHeader header = in.read<SnapshotHeader>();
+		if (!in.ok() || !header.compatible<Traits>()) return false;
+		return reg.load(in);
+	}
+
+	// 先为列出的组件建好池，再读入
+	template<typename... Components, typename Traits>
+	requires (sizeof...(Components) > 0)
+	bool load_snapshot(BasicRegistry<Traits>& reg, const char* path) {
+		((void)reg.template storage<Components>(), ...);
+		return load_snapshot(reg, path);
+	}
+}
@@ -0,0 +1,280 @@
+#pragma once
+#include "Registry.hpp"
+#include <tuple>
+#include <memory_resource>
+#include <span>
+
+namespace Rinn {
+
+	template<typename Registry, typename... Components> class BasicStaticView;
+
+	// 类型在列表中的下标 (编译期)；不在列表中时编译失败
+	template<typename T, typename... Ts>
+	struct type_index;
+	template<typename T, typename... Rest>
+	struct type_index<T, T, Rest...> : std::integral_constant<Component_ID, 0> {};
+	template<typename T, typename First, typename... Rest>
+	struct type_index<T, First, Rest...> : std::integral_constant<Component_ID, 1 + type_index<T, Rest...>::value> {};
+	template<typename T>
+	struct type_index<T> {
+		static_assert(sizeof(T) == 0, "Component is not part of the static registry's component list!");
+	};
+
+	// =========================================================================
+	// 静态 Registry：组件集合在编译期固定 (例如 ComponentList.hpp 的 AllComponents)
+	// -------------------------------------------------------------------------
+	// - 组件 ID 是类型在列表中的下标 (constexpr)：没有函数内静态变量的守卫检查，ID 与首次使用顺序无关
+	// - 组件池直接放在 std::tuple 里：没有 unique_ptr、没有延迟创建和空指针检查
+	// - destroy_entity / clear 用折叠表达式逐类型展开，池调用带限定名，不走虚函数
+	// - 存储策略与动态 Registry 相同 (SparseSet / ColumnSet / TagSet，见 storage_for_t)
+	// - 不支持分组、持久查询和快照；插件等运行期才知道的组件继续用 BasicRegistry
+	// 与 BasicRegistry 一样体积较大 (实体池 + 签名数组内联)，请放在堆或静态区
+	//
+	// 目前只是基准测试用的原型 (bench_static_registry)，不是 BasicRegistry 的替代品：
+	// - Scheduler / CommandBuffer / LuaBinder / Snapshot 都只认 BasicRegistry
+	// - 没有生命周期信号，View 只有 each：没有迭代器、par_each、changed_since、exclude
+	// 游戏代码请继续用 Registry
+	// =========================================================================
+	template<typename ComponentList, typename Traits = DefaultEntityTraits>
+	class BasicStaticRegistry;
+
+	template<typename... Ts, typename Traits>
+	class BasicStaticRegistry<std::tuple<Ts...>, Traits> {
+	public:
+		using traits_type = Traits;
+		using Entity = BasicEntity<Traits>;
+
+		template<typename T>
+		using pool_type = storage_for_t<std::remove_const_t<T>, Traits>;
+
+		static_assert(sizeof...(Ts) <= MAX_COMPONENTS, "Too many components for a Signature!");
+
+		// 编译期组件 ID：const T 与 T 共用一个
+		template<typename T>
+		static constexpr Component_ID id_of = type_index<std::remove_cvref_t<T>, Ts...>::value;
+
+	private:
+		template<typename, typename...> friend class BasicStaticView;
+
+		BasicEntityPool<Traits> entity_pool;
+		EntityArray<Signature, Traits::MAX_ENTITIES> entity_signatures;
+		std::tuple<pool_type<Ts>...> pools;
+
+		Tick current_tick = 1;		// 0 留给 “从未写入”
+
+		template<typename T>
+		[[nodiscard]] pool_type<T>& pool() noexcept { return std::get<pool_type<T>>(pools); }
+		template<typename T>
+		[[nodiscard]] const pool_type<T>& pool() const noexcept { return std::get<pool_type<T>>(pools); }
+
+	public:
+		// resource：组件存储的内存来源 (必须比 Registry 活得久)
+		explicit BasicStaticRegistry(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: pools(((void)sizeof(Ts), resource)...) {
+			(pool<Ts>().set_tick(current_tick), ...);
+		}
+
+		// 提供一个辅助函数，返回 View 对象
+		template<typename... Components>
+		requires (sizeof...(Components) > 0)
+		BasicStaticView<BasicStaticRegistry, Components...> view() {
+			return BasicStaticView<BasicStaticRegistry, Components...>(*this);
+		}
+
+		// 直接访问组件池
+		template<typename T>
+		[[nodiscard]] pool_type<T>& storage() noexcept { return pool<T>(); }
+
+		[[nodiscard]] Tick tick() const noexcept { return current_tick; }
+
+		// 推进到下一个 tick 并同步到所有组件池，返回新 tick
+		Tick advance_tick() noexcept {
+			++current_tick;
+			(pool<Ts>().set_tick(current_tick), ...);
+			return current_tick;
+		}
+
+		[[nodiscard]] bool is_alive(Entity entity) const noexcept {
+			return entity_pool.is_valid(entity);
+		}
+
+		[[nodiscard]] Entity create_entity() noexcept {
+			Entity entity = entity_pool.acquire();
+			entity_signatures.ensure(entity_pool.high_water());	// 内联存储时为空操作
+			return entity;
+		}
+
+		void create_entities(std::span<Entity> out) {
+			for (Entity& entity : out) {
+				entity = entity_pool.acquire();
+			}
+			entity_signatures.ensure(entity_pool.high_water());
+		}
+
+		[[nodiscard]] std::vector<Entity> create_entities(size_t count) {
+			std::vector<Entity> entities(count);
+			create_entities(std::span<Entity>(entities));
+			return entities;
+		}
+
+		template<typename T>
+		[[nodiscard]] bool has(Entity entity) const {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			return entity_signatures[entity.index()][id_of<T>];
+		}
+
+		// 原地构造；列式组件返回行代理而不是 T&
+		template<typename T, typename... Args>
+		[[nodiscard]] decltype(auto) emplace(Entity entity, Args&&... args) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			using P = pool_type<T>;
+			Signature& sig = entity_signatures[entity.index()];
+			if constexpr (tag_storage<T>) {
+				if (!sig[id_of<T>]) {
+					sig.set(id_of<T>);
+					pool<T>().add();
+				}
+				return pool<T>().P::get(entity);
+			}
+			else {
+				sig.set(id_of<T>);
+				return pool<T>().P::emplace(entity, std::forward<Args>(args)...);
+			}
+		}
+
+		template<typename T>
+		[[nodiscard]] decltype(auto) get(Entity entity) {
+			assert(has<T>(entity) && "Entity does not have component! Use try_get() for safe access.");
+			using P = pool_type<T>;
+			return pool<T>().P::get(entity);
+		}
+
+		// 只读路径：不记录修改 (列式组件按值返回)
+		template<typename T>
+		[[nodiscard]] decltype(auto) get(Entity entity) const {
+			assert(has<T>(entity) && "Entity does not have component! Use try_get() for safe access.");
+			using P = pool_type<T>;
+			return pool<T>().P::get(entity);
+		}
+
+		template<typename T>
+		requires (!column_storage<T>)
+		[[nodiscard]] std::optional<std::reference_wrapper<T>> try_get(Entity entity) noexcept {
+			if (!is_alive(entity) || !entity_signatures[entity.index()][id_of<T>]) return std::nullopt;
+			return std::ref(get<T>(entity));
+		}
+
+		template<typename T>
+		requires (!column_storage<T>)
+		[[nodiscard]] std::optional<std::reference_wrapper<const T>> try_get(Entity entity) const noexcept {
+			if (!is_alive(entity) || !entity_signatures[entity.index()][id_of<T>]) return std::nullopt;
+			return std::cref(get<T>(entity));
+		}
+
+		template<typename T>
+		void remove(Entity entity) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			Signature& sig = entity_signatures[entity.index()];
+			if (!sig[id_of<T>]) return;
+			sig.reset(id_of<T>);
+			using P = pool_type<T>;
+			pool<T>().P::remove(entity);
+		}
+
+		// 按签名逐类型展开：只碰实体真正拥有的池
+		void destroy_entity(Entity entity) {
+			assert(is_alive(entity) && "Entity is dead or stale!");
+			Signature& sig = entity_signatures[entity.index()];
+			([&] {
+				using P = pool_type<Ts>;
+				if (sig[id_of<Ts>]) pool<Ts>().P::remove(entity);
+				}(), ...);
+			sig.reset();
+			entity_pool.release(entity.index());
+		}
+
+		void destroy_entities(std::span<const Entity> entities) {
+			for (Entity entity : entities) {
+				destroy_entity(entity);
+			}
+		}
+
+		[[nodiscard]] size_t size() const noexcept { return entity_pool.size(); }
+
+		// 清空实体与组件，组件池本身保留
+		void clear() {
+			([&] {
+				using P = pool_type<Ts>;
+				pool<Ts>().P::clear();
+				}(), ...);
+			entity_signatures.reset(Signature{});
+			entity_pool.clear();
+		}
+	};
+
+	// 静态 Registry 的 View：必需组件的掩码是编译期常量，池是 tuple 里的具体类型
+	// 以最小的非标记池为候选逐个查签名；全是标记组件时按实体下标扫描签名
+	template<typename Registry, typename... Components>
+	class BasicStaticView {
+	public:
+		using Entity = typename Registry::Entity;
+
+	private:
+		template<typename C>
+		using pool_of = typename Registry::template pool_type<C>;
+
+		// 与 BasicView 相同：AoS 为引用；列式组件只能只读，按值拼回
+		template<typename C>
+		using reference_of = std::conditional_t<column_storage<C>, std::remove_const_t<C>, C&>;
+
+		static_assert(MAX_COMPONENTS <= 64, "Static view mask assumes to_ullong()!");
+		static constexpr unsigned long long REQUIRED = ((1ull << Registry::template id_of<Components>) | ...);
+
+		Registry& reg;
+		const Entity* candidates = nullptr;
+		size_t count = 0;
+
+		template<typename C>
+		[[nodiscard]] reference_of<C> fetch(Entity entity) const {
+			static_assert(std::is_const_v<C> || !column_storage<C>,
+				"Column components are read-only in views; write through Registry::get");
+			using P = pool_of<C>;
+			if constexpr (std::is_const_v<C>) return std::as_const(reg.template pool<C>()).P::get(entity);
+			else return reg.template pool<C>().P::get(entity);
+		}
+
+		[[nodiscard]] Entity entity_at(size_t i) const noexcept {
+			return candidates != nullptr ? candidates[i] : reg.entity_pool.entity_at(i);
+		}
+
+	public:
+		explicit BasicStaticView(Registry& r) : reg(r) {
+			size_t min_size = SIZE_MAX;
+			([&] {
+				using P = pool_of<Components>;
+				const P& pool = reg.template pool<Components>();
+				if (!tag_storage<Components> && pool.P::size() < min_size) {
+					min_size = pool.P::size();
+					candidates = pool.P::entity_data();
+				}
+				}(), ...);
+			count = candidates != nullptr ? min_size : reg.entity_pool.high_water();
+			if (((tag_storage<Components> && reg.template pool<Components>().size() == 0) || ...)) {
+				count = 0;		// 有标记组件一个实体都没有
+			}
+		}
+
+		// 回调式遍历：func(Entity, Components&...)
+		template<typename Func>
+		requires std::invocable<Func&, Entity, reference_of<Components>...>
+		void each(Func&& func) const {
+			const Signature* signatures = reg.entity_signatures.raw();
+			for (size_t i = 0; i < count; ++i) {
+				const Entity entity = entity_at(i);
+				if ((signatures[entity.index()].to_ullong() & REQUIRED) == REQUIRED) {
+					func(entity, fetch<Components>(entity)...);
+				}
+			}
+		}
+	};
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "SparseSet.hpp"
+#include <memory_resource>
+
+namespace Rinn {
+
+	// =========================================================================
+	// 标记组件池 (空类型，如 IsStatic / Selected / Burning)
+	// -------------------------------------------------------------------------
+	// - 成员关系只存在实体签名里：Registry 的 emplace / remove / has 都只是一次置位 / 清位 / 测位
+	// - 池本身只记数量和整池 last_write：没有稀疏页、实体数组、组件数组，也没有逐实体 tick
+	// - View 不拿标记池当候选，只用签名过滤；全是标记的 View 按实体水位线扫描签名
+	// - get 返回同一个静态空对象：空类型没有可读写的字节，取引用只是为了与 SparseSet 接口一致
+	// - 不能分组、排序，也不参与变更过滤 (changed_since / added_since 不能指定标记组件)
+	// =========================================================================
+	template<typename T, typename Traits = DefaultEntityTraits>
+	class TagSet : public ISparseSet<Traits> {
+	private:
+		using Base = ISparseSet<Traits>;
+		using typename Base::Entity;
+		using Base::touch;
+		using typename Base::SnapshotCheck;
+
+		static_assert(std::is_empty_v<T> && std::is_default_constructible_v<T>, "Tag component must be an empty, default constructible type!");
+
+		inline static T instance{};
+
+		size_t count = 0;
+
+	public:
+		using value_type = T;
+
+		explicit TagSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : Base(resource) {}
+
+		// 由 Registry 在签名位从 0 变 1 时调用
+		void add() noexcept {
+			++count;
+			touch();
+		}
+
+		// 由 Registry 在签名位从 1 变 0 时调用 (含 destroy_entity)
+		void remove(Entity) override {
+			assert(count != 0 && "Tag count underflow!");
+			--count;
+			touch();
+		}
+
+		[[nodiscard]] T& get(Entity) noexcept { return instance; }
+		[[nodiscard]] const T& get(Entity) const noexcept { return instance; }
+
+		// 没有逐实体 tick：查询一律返回 0 (“从未写入”)
+		void mark_changed(Entity) noexcept {}
+		[[nodiscard]] Tick added_tick(Entity) const noexcept { return 0; }
+		[[nodiscard]] Tick changed_tick(Entity) const noexcept { return 0; }
+
+		void swap_dense(size_t, size_t) override { assert(false && "Tag components cannot be grouped!"); }
+
+		void clear() override {
+			count = 0;
+			touch();
+		}
+
+		// 带该标记的实体数 (不能按下标遍历：entity_data() 为空)
+		[[nodiscard]] size_t size() const noexcept override { return count; }
+		[[nodiscard]] const Entity* entity_data() const noexcept override { return nullptr; }
+
+		[[nodiscard]] size_t capacity() const noexcept override { return 0; }
+		[[nodiscard]] size_t dense_bytes() const noexcept override { return 0; }
+		void shrink_to(size_t) override {}
+
+		// 快照：成员关系随签名块一起保存，这里只有布局记录和数量
+		static constexpr std::array<BlockLayout, 1> LAYOUT{ layout_of<T>() };
+
+		[[nodiscard]] uint64_t type_key() const noexcept override { return get_component_type_key<T>(); }
+		[[nodiscard]] bool serializable() const noexcept override { return true; }
+		void save(BinaryWriter& out) const override { write_layout(out, LAYOUT); }
+		// 成员关系不在这里：数量与签名是否一致由 Registry 校验
+		[[nodiscard]] bool load(BinaryReader& in, size_t saved_count, const SnapshotCheck&) override {
+			if (!read_layout(in, LAYOUT)) return false;
+			count = saved_count;
+			touch();
+			return true;
+		}
+	};
+}
@@ -4,6 +4,7 @@
 #include <raylib.h>
 #include <vector>
 #include <cassert>
+#include "Core/Profiler.hpp"
 namespace Rinn {
     class ResourceManager {
         std::vector<Texture2D> textures;
@@ -30,6 +31,7 @@ namespace Rinn {
         }
 
         // 2. 未加载则加载
+        RINN_PROFILE_ZONE("ResourceManager::load_texture");
         Texture2D tex = LoadTexture(path.c_str());
         uint16_t id = static_cast<uint16_t>(textures.size());
         textures.push_back(tex);
@@ -0,0 +1,50 @@
+#pragma once
+#include "Core/Registry.hpp"
+#include <stdexcept>
+
+namespace Rinn {
+
+    // ========================================
+    // Lua 侧的零拷贝组件代理
+    // ----------------------------------------
+    // 只存 (组件池指针, 实体句柄)，每次字段访问都重新定位到 Dense 槽位：
+    // Dense 扩容、swap-and-pop、分组换位之后依然有效，不会悬空
+    // 列式组件 (ColumnSet) 没有 T& 可取：读按值拼回一行，写只改对应的那一列
+    // Reg 为 Archetype 后端时 Pool 是存储门面，同样按句柄重新定位
+    // ========================================
+    template<typename T, typename Reg = Registry>
+    struct ComponentRef {
+        using Pool = typename Reg::template pool_type<T>;
+        using Entity = typename Reg::Entity;
+        Pool* pool = nullptr;           // 非拥有：组件池由 Registry 持有，地址稳定
+        Entity entity;
+
+        static constexpr bool has_reference = std::is_lvalue_reference_v<decltype(std::declval<Pool&>().get(std::declval<Entity>()))>;
+
+        // 组件仍然存在且属于同一个句柄 (实体销毁/组件移除后为 false)
+        [[nodiscard]] bool valid() const noexcept {
+            return pool != nullptr && !entity.is_null() && pool->contains(entity);
+        }
+
+        // 失效时抛异常，由 sol2 转成 Lua 错误，不会让 C++ 侧崩溃
+        // 可写访问：记下 changed tick (字段 setter 走这里)
+        [[nodiscard]] T& get() const requires has_reference {
+            if (!valid()) throw std::runtime_error("stale component reference");
+            return pool->get(entity);
+        }
+
+        // 只读访问：不记录修改 (字段 getter 走这里)；列式组件按值返回
+        [[nodiscard]] decltype(auto) read() const {
+            if (!valid()) throw std::runtime_error("stale component reference");
+            return std::as_const(*pool).get(entity);
+        }
+
+        // 写单个字段：记下 changed tick (字段 setter 走这里)
+        template<typename M>
+        void write(M T::* member, const M& value) const {
+            if (!valid()) throw std::runtime_error("stale component reference");
+            if constexpr (!has_reference) pool->set_field(entity, member, value);
+            else pool->get(entity).*member = value;
+        }
+    };
+}
@@ -1,7 +1,15 @@
 #pragma once
 #include <sol/sol.hpp>
 #include "components/Components.hpp"
+#include <tuple>
 namespace Rinn {
+    // 字段描述：Lua 字段名 + 成员指针，用于生成零拷贝代理 (ComponentRef) 的 getter/setter
+    template<typename C, typename M>
+    struct Field {
+        const char* name;
+        M C::* member;
+    };
+
     // 未找到特化模板将会使用主模板
     // 主模板（未特化会编译报错）
     template<typename T>
@@ -12,6 +20,8 @@ namespace Rinn {
     template<>
     struct ComponentTrait<Transform> {
         static constexpr const char* name = "Transform";
+        static constexpr auto fields = std::make_tuple(
+            Field{ "x", &Transform::x }, Field{ "y", &Transform::y }, Field{ "layer", &Transform::layer });
 
         static Transform from_table(sol::table t) {
             return { t.get_or("x", 0.0f), t.get_or("y", 0.0f), t.get_or("layer", 0) };
@@ -25,6 +35,7 @@ namespace Rinn {
     template<>
     struct ComponentTrait<Velocity> {
         static constexpr const char* name = "Velocity";
+        static constexpr auto fields = std::make_tuple(Field{ "vx", &Velocity::vx }, Field{ "vy", &Velocity::vy });
 
         static Velocity from_table(sol::table t) {
             return { t.get_or("vx", 0.0f), t.get_or("vy", 0.0f) };
@@ -38,6 +49,7 @@ namespace Rinn {
     template<>
     struct ComponentTrait<RigidBody> {
         static constexpr const char* name = "RigidBody";
+        static constexpr auto fields = std::make_tuple(Field{ "vx", &RigidBody::vx }, Field{ "vy", &RigidBody::vy });
 
         static RigidBody from_table(sol::table t) {
             return { t.get_or("vx", 0.0f), t.get_or("vy", 0.0f) };
@@ -51,6 +63,8 @@ namespace Rinn {
     template<>
     struct ComponentTrait<Sprite> {
         static constexpr const char* name = "Sprite";
+        static constexpr auto fields = std::make_tuple(
+            Field{ "texture_id", &Sprite::texture_id }, Field{ "width", &Sprite::width }, Field{ "height", &Sprite::height });
         static Sprite from_table(sol::table t) {
             return {
                 t.get_or<uint16_t>("texture_id", 0),
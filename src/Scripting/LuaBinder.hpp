@@ -1,56 +1,239 @@
 #pragma once
 #include "Core/Registry.hpp"
+#include "Core/Memory.hpp"
 #include "Scripting/ScriptContext.hpp"
 #include "ComponentList.hpp"
 #include "ComponentTraits.hpp"
-#include "Resources/ResourceManager.hpp"
+#include "ComponentRef.hpp"
+#include "Systems/SpatialGrid.hpp"
+#include <memory>
 #include <string>
+#include <vector>
+#include <span>
+#include <utility>
+#include <stdexcept>
 namespace Rinn {
 
-	// 绑定单个组件的所有操作
-	template<typename T>
-	void bind_component(sol::state& lua, Registry& reg) {
+	// 代理字段：getter/setter 直接读写 Dense (或对应的列) 中的成员，无 table 分配
+	template<typename Ref, typename C, typename M>
+	void bind_field(sol::usertype<Ref>& type, Field<C, M> field) {
+		type[field.name] = sol::property(
+			[member = field.member](const Ref& ref) -> M { return ref.read().*member; },
+			[member = field.member](const Ref& ref, M value) { ref.write(member, value); }
+		);
+	}
+
+	// 注册组件代理类型 (如 TransformRef)，字段由 ComponentTrait::fields 生成
+	template<typename T, typename Reg = Registry>
+	void bind_component_ref(sol::state& lua) {
+		using Trait = ComponentTrait<T>;
+		using Ref = ComponentRef<T, Reg>;
+
+		sol::usertype<Ref> type = lua.new_usertype<Ref>(std::string(Trait::name) + "Ref", sol::no_constructor);
+		std::apply([&type](auto... field) { (bind_field(type, field), ...); }, Trait::fields);
+		type["valid"] = &Ref::valid;
+		type["entity"] = sol::readonly_property([](const Ref& ref) { return ref.entity; });
+	}
+
+	// 结构数组 (SoA) 形式的一列：{ x = {1, 2, ...}, y = {...} } 中的 data[field.name]
+	template<typename C, typename M>
+	void read_column(const sol::table& data, Field<C, M> field, std::vector<C>& values) {
+		sol::optional<sol::table> column = data[field.name];
+		if (!column) return;	// 缺省列保持 from_table 的默认值
+		for (size_t i = 0; i < values.size(); ++i) {
+			values[i].*field.member = column->get_or<M>(i + 1, values[i].*field.member);
+		}
+	}
+
+	// Lua 数组 -> 实体句柄 (拒绝失效句柄，抛出的异常由 sol2 转成 Lua 错误)
+	template<typename Reg>
+	std::vector<typename Reg::Entity> read_entities(const sol::table& entities, const Reg& reg) {
+		using Entity = typename Reg::Entity;
+		std::vector<Entity> handles;
+		handles.reserve(entities.size());
+		for (size_t i = 1; i <= entities.size(); ++i) {
+			Entity e = entities.get<Entity>(i);
+			if (!reg.is_alive(e)) throw std::runtime_error("entity is dead or stale");
+			handles.push_back(e);
+		}
+		return handles;
+	}
+
+	// 查询结果写回调用方复用的 Lua 数组 (数组本身不再分配)，返回命中数 n
+	// 每个槽位写入新的 Entity 值：脚本里保存过的旧句柄 (target = hits[1]) 不会被改成别的实体
+	// out[n + 1] 置 nil，ipairs 在结果末尾停下；更后面的旧元素保留
+	template<typename E>
+	size_t write_entities(sol::table& out, std::span<const E> results) {
+		for (size_t i = 0; i < results.size(); ++i) {
+			out[i + 1] = results[i];
+		}
+		out[results.size() + 1] = sol::lua_nil;
+		return results.size();
+	}
+
+	template<typename E, typename Alloc>
+	size_t write_entities(sol::table& out, const std::vector<E, Alloc>& results) {
+		return write_entities(out, std::span<const E>(results));
+	}
+
+	// Lua 回调在 Registry 信号上的连接表 (放在 Lua 注册表里的 userdata)
+	// 回调持有 sol::function / sol::table，必须在 lua_State 关闭前从信号上摘掉：
+	// lua_close 回收这个 userdata 时析构函数统一断开，此时状态仍然可用
+	// 与其他绑定一样要求 Registry 比 Lua 状态活得久
+	template<typename Signal>
+	class LuaSignalConnections {
+	public:
+		static constexpr const char* KEY = "rinn.signal_connections";
+
+		LuaSignalConnections() = default;
+		LuaSignalConnections(const LuaSignalConnections&) = delete;
+		LuaSignalConnections& operator=(const LuaSignalConnections&) = delete;
+		LuaSignalConnections(LuaSignalConnections&& other) noexcept : connections(std::move(other.connections)) { other.connections.clear(); }
+		LuaSignalConnections& operator=(LuaSignalConnections&&) = delete;
+
+		~LuaSignalConnections() {
+			for (auto [signal, id] : connections) signal->disconnect(id);
+		}
+
+		void add(Signal& signal, typename Signal::Connection id) { connections.emplace_back(&signal, id); }
+
+		void remove(Signal& signal, typename Signal::Connection id) {
+			signal.disconnect(id);
+			std::erase(connections, std::pair{ &signal, id });
+		}
+
+	private:
+		std::vector<std::pair<Signal*, typename Signal::Connection>> connections;
+	};
+
+	// 取 (第一次时创建) 该 Lua 状态的连接表；userdata 不搬家，可以长期持有引用
+	template<typename Signal>
+	LuaSignalConnections<Signal>& lua_signal_connections(sol::state& lua) {
+		using Connections = LuaSignalConnections<Signal>;
+		sol::table registry = lua.registry();
+		const sol::object existing = registry[Connections::KEY];
+		if (!existing.is<Connections>()) registry[Connections::KEY] = Connections{};
+		return registry.get<Connections&>(Connections::KEY);
+	}
+
+	// 绑定单个组件的所有操作 (Reg 为 Registry 或 ArchetypeRegistry)
+	template<typename T, typename Reg>
+	void bind_component(sol::state& lua, Reg& reg) {
 		using Trait = ComponentTrait<T>;
+		using Entity = typename Reg::Entity;
 		std::string n = Trait::name;
 
-		// emplace: 从 Lua table 构造组件
+		// ref: 零拷贝代理 (推荐路径)，t.x = t.x + 1 直接写 Dense
+		bind_component_ref<T, Reg>(lua);
+		lua["ref_" + n] = [&reg](Entity e) {
+			assert(reg.is_alive(e) && "Entity is dead or stale!");
+			return ComponentRef<T, Reg>{ &reg.template storage<T>(), e };
+			};
+
+		// emplace: 从 Lua table 构造组件 (兼容路径：按字符串键解析 table)
 		lua["emplace_" + n] = [&reg](Entity e, sol::table t) {
-			reg.emplace<T>(e, Trait::from_table(t));
+			(void)reg.template emplace<T>(e, Trait::from_table(t));
 			};
 
-		// get: 返回 Lua table
+		// emplace_many: 一次跨越边界批量挂组件 (已有该组件的实体保持原值，与 emplace 一致)
+		//   数组形式：emplace_many_Transform(es, { {x=1, y=2}, {x=3, y=4} })
+		//   SoA 形式：emplace_many_Transform(es, { x = {1, 3}, y = {2, 4} })
+		lua["emplace_many_" + n] = [&reg](sol::table entities, sol::table data, sol::this_state ts) {
+			sol::state_view lua(ts);
+			const std::vector<Entity> handles = read_entities(entities, reg);
+			std::vector<T> values;
+
+			if (data[1].valid()) {
+				values.reserve(handles.size());
+				for (size_t i = 1; i <= handles.size(); ++i) {
+					values.push_back(Trait::from_table(data.get<sol::table>(i)));
+				}
+			}
+			else {
+				values.assign(handles.size(), Trait::from_table(lua.create_table()));
+				std::apply([&](auto... field) { (read_column(data, field, values), ...); }, Trait::fields);
+			}
+
+			reg.template emplace_many<T>(handles, values);
+			};
+
+		// get: 返回 Lua table (兼容路径：每次调用分配新 table，热路径请用 ref_)
 		lua["get_" + n] = [&reg](Entity e, sol::this_state ts) -> sol::table {
 			sol::state_view lua(ts);
-			return Trait::to_table(lua, reg.get<T>(e));
+			return Trait::to_table(lua, std::as_const(reg).template get<T>(e));	// 只读，不记录修改
+			};
+
+		// 增量：自 since 起修改 / 新增了该组件的实体，写回复用数组，返回数量
+		//   local n = changed_Transform(last_tick, dirty)
+		auto dirty = std::make_shared<std::vector<Entity>>();
+		lua["changed_" + n] = [&reg, dirty](Tick since, sol::table out) {
+			dirty->clear();
+			reg.template view<const T>().changed_since(since).each([&](Entity e, const T&) { dirty->push_back(e); });
+			return write_entities(out, *dirty);
+			};
+
+		lua["added_" + n] = [&reg, dirty](Tick since, sol::table out) {
+			dirty->clear();
+			reg.template view<const T>().added_since(since).each([&](Entity e, const T&) { dirty->push_back(e); });
+			return write_entities(out, *dirty);
 			};
 
 		// has: 检查组件
 		lua["has_" + n] = [&reg](Entity e) {
-			return reg.has<T>(e);
+			return reg.template has<T>(e);
 			};
 
 		// remove: 删除组件
 		lua["remove_" + n] = [&reg](Entity e) {
-			reg.remove<T>(e);
+			reg.template remove<T>(e);
 			};
+
+		// 生命周期信号 (只有稀疏集 Registry 提供)：批量监听，每帧 flush_signals 时一次回调
+		//   local id = on_construct_Sprite(function(es, n) for i = 1, n do ... es[i] ... end end)
+		//   off_construct_Sprite(id)
+		// es 是该监听独占的复用数组，只有 es[1..n] 有效；实体可能已被销毁，需要 is_alive 检查
+		// Lua 状态关闭时自动断开 (见 LuaSignalConnections)
+		if constexpr (requires { reg.template on_construct<T>(); }) {
+			using Signal = typename Reg::signal_type;
+			LuaSignalConnections<Signal>& connections = lua_signal_connections<Signal>(lua);
+			auto bind_signal = [&lua, &connections](const std::string& event, Signal& signal) {
+				lua["on_" + event] = [&signal, &connections](sol::function fn, sol::this_state ts) {
+					sol::table buffer = sol::state_view(ts).create_table();
+					const auto id = signal.connect_batched([fn = std::move(fn), buffer](Reg&, std::span<const Entity> batch) mutable {
+						fn(buffer, write_entities(buffer, batch));
+						});
+					connections.add(signal, id);
+					return id;
+					};
+				lua["off_" + event] = [&signal, &connections](typename Signal::Connection id) {
+					connections.remove(signal, id);
+					};
+				};
+			bind_signal("construct_" + n, reg.template on_construct<T>());
+			bind_signal("update_" + n, reg.template on_update<T>());
+			bind_signal("destroy_" + n, reg.template on_destroy<T>());
+		}
 	}
 	// 辅助：展开 tuple 绑定所有类型
-	template<typename Tuple, std::size_t... Is>
-	void bind_all_impl(sol::state& lua, Registry& reg, std::index_sequence<Is...>) {
+	template<typename Tuple, typename Reg, std::size_t... Is>
+	void bind_all_impl(sol::state& lua, Reg& reg, std::index_sequence<Is...>) {
 		(bind_component<std::tuple_element_t<Is, Tuple>>(lua, reg), ...);
 	}
 	// ========================================
 	// 🚀 一行绑定所有组件！
 	// ========================================
-	inline void bind_all_components(sol::state& lua, Registry& reg) {
+	template<typename Reg>
+	void bind_all_components(sol::state& lua, Reg& reg) {
 		bind_all_impl<AllComponents>(
 			lua, reg,
 			std::make_index_sequence<std::tuple_size_v<AllComponents>>{}
 		);
 	}
 
-	// 绑定Registry
-	inline void bind_registry(sol::state& lua, Registry& reg) {
+	// 绑定Registry (稀疏集后端或 Archetype 后端，Lua 侧接口相同)
+	template<typename Reg>
+	void bind_registry(sol::state& lua, Reg& reg) {
+		using Entity = typename Reg::Entity;
 
 		// 1. 绑定 Entity 类型
 		lua.new_usertype<Entity>("Entity",
@@ -68,17 +251,53 @@ namespace Rinn {
 				return reg.destroy_entity(e);
 			};
 
+		// 批量：create_entities(n) 返回实体数组；destroy_entities(es)
+		lua["create_entities"] = [&reg](size_t count) {
+				return sol::as_table(reg.create_entities(count));
+			};
+
+		lua["destroy_entities"] = [&reg](sol::table entities) {
+				reg.destroy_entities(read_entities(entities, reg));
+			};
+
 		lua["is_alive"] = [&reg](Entity e) {
 				return reg.is_alive(e);
 			};
 
+		// 当前变更 tick (每帧推进)，配合 changed_<Name> / added_<Name> 做增量逻辑
+		lua["current_tick"] = [&reg]() {
+				return reg.tick();
+			};
+
 		bind_all_components(lua, reg);
 		
 	}
-	// 绑定资源管理器
-	inline void bind_resources(sol::state& lua, ResourceManager& rm) {
-		lua["load_texture"] = [&rm](const std::string& path) {
-			return rm.load_texture(path);
+	// 绑定空间网格查询 (只读；网格由 C++ 侧每帧 update)
+	//   local hits = {}
+	//   local n = query_radius(x, y, 64, hits)
+	//   for i = 1, n do ... hits[i] ... end
+	// C++ 侧的结果缓冲是帧分配器上的临时数组 (scheduler.frame_arena())，调用结束即丢弃，由下一帧 reset 回收
+	inline void bind_spatial(sol::state& lua, const SpatialGrid& grid, FrameArena& scratch) {
+		lua["query_radius"] = [&grid, &scratch](float x, float y, float radius, sol::table out) {
+			std::pmr::vector<Entity> results(&scratch);
+			grid.query_radius(x, y, radius, results);
+			return write_entities(out, results);
+			};
+
+		lua["query_aabb"] = [&grid, &scratch](float min_x, float min_y, float max_x, float max_y, sol::table out) {
+			std::pmr::vector<Entity> results(&scratch);
+			grid.query_aabb(min_x, min_y, max_x, max_y, results);
+			return write_entities(out, results);
+			};
+
+		lua["query_nearest"] = [&grid, &scratch](float x, float y, size_t k, sol::table out) {
+			std::pmr::vector<SpatialGrid::Neighbor> neighbors(&scratch);
+			neighbors.reserve(k);
+			grid.query_nearest(x, y, k, neighbors);
+			std::pmr::vector<Entity> results(&scratch);
+			results.reserve(neighbors.size());
+			for (const SpatialGrid::Neighbor& n : neighbors) results.push_back(n.entity);
+			return write_entities(out, results);
 			};
 	}
 }
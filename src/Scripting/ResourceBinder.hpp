@@ -0,0 +1,13 @@
+#pragma once
+#include "Scripting/ScriptContext.hpp"
+#include "Resources/ResourceManager.hpp"
+#include <string>
+namespace Rinn {
+
+	// 绑定资源管理器 (依赖 raylib，与 LuaBinder 分开：无窗口的目标只绑定 ECS)
+	inline void bind_resources(sol::state& lua, ResourceManager& rm) {
+		lua["load_texture"] = [&rm](const std::string& path) {
+			return rm.load_texture(path);
+			};
+	}
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include <sol/sol.hpp>
+#include "Core/Profiler.hpp"
 
 namespace Rinn {
     // 封装 Lua 虚拟机
@@ -14,10 +15,12 @@ namespace Rinn {
 
         // 接受字符串，Lua解释器解释并执行
         void run(const std::string& code) {
+            RINN_PROFILE_ZONE("ScriptContext::run");
             lua.script(code);
         }
 
         void run_file(const std::string& path) {
+            RINN_PROFILE_ZONE("ScriptContext::run_file");
             lua.script_file(path);
         }
 
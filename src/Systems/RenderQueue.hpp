@@ -0,0 +1,154 @@
+#pragma once
+#include "Core/Registry.hpp"
+#include "components/Components.hpp"
+#include <array>
+#include <bit>
+#include <vector>
+#include <algorithm>
+
+namespace Rinn {
+
+    // 相机可见区域 (世界坐标，左上角 + 宽高)
+    struct CullRect {
+        float x = 0.0f, y = 0.0f;
+        float width = 0.0f, height = 0.0f;
+    };
+
+    // 排序后的一条绘制指令：16 字节，绘制阶段顺序读
+    struct RenderItem {
+        uint64_t key;       // [layer 16 | texture_id 16 | y-depth 32]
+        float x, y;
+
+        [[nodiscard]] uint16_t texture_id() const noexcept { return static_cast<uint16_t>(key >> 32); }
+    };
+
+    // 同一贴图的连续区间：后端一次绑定贴图，整段提交 (raylib 内部自动合批)
+    struct RenderRun {
+        uint16_t texture_id;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    // =========================================================================
+    // 渲染队列 (CPU 侧，无窗口，不依赖 raylib)
+    // -------------------------------------------------------------------------
+    // 1. 遍历 View<Transform, Sprite>，按 Sprite::width/height 与相机矩形做 AABB 剔除
+    // 2. 打包 64 位排序键：layer 决定遮挡；同层内按贴图聚拢；同贴图内按底边 y 由远到近
+    // 3. LSD 基数排序 (8 位一趟，整趟相同的字节直接跳过)
+    // 4. 切出按贴图连续的 RenderRun 交给后端
+    // 所有缓冲跨帧复用，稳态下每帧零分配
+    // 增量：相机不动且 Transform / Sprite 池自上次构建后没有任何写入时，直接沿用上一帧结果
+    // =========================================================================
+    class RenderQueue {
+    public:
+        // Reg：BasicRegistry 或 BasicArchetypeRegistry
+        template<typename Reg>
+        void build(Reg& registry, const CullRect& camera) {
+            const Tick transform_write = registry.template storage<Transform>().last_write();
+            const Tick sprite_write = registry.template storage<Sprite>().last_write();
+            if (built && same_rect(camera, built_camera) && transform_write < built_tick && sprite_write < built_tick) {
+                rebuilt = false;
+                return;
+            }
+
+            rebuilt = true;
+            built = true;
+            built_tick = registry.tick();
+            built_camera = camera;
+            items.clear();
+            culled_count = 0;
+
+            const float right = camera.x + camera.width;
+            const float bottom = camera.y + camera.height;
+            registry.template view<const Transform, const Sprite>().each(
+                [&](typename Reg::Entity, const Transform& t, const Sprite& s) {
+                    if (t.x + s.width < camera.x || t.x > right || t.y + s.height < camera.y || t.y > bottom) {
+                        ++culled_count;
+                        return;
+                    }
+                    items.push_back({ make_key(t.layer, s.texture_id, t.y + s.height), t.x, t.y });
+                });
+
+            radix_sort();
+            build_runs();
+        }
+
+        [[nodiscard]] const std::vector<RenderItem>& sorted() const noexcept { return items; }
+        [[nodiscard]] const std::vector<RenderRun>& runs() const noexcept { return run_list; }
+        [[nodiscard]] size_t visible_count() const noexcept { return items.size(); }
+        [[nodiscard]] size_t culled() const noexcept { return culled_count; }
+        [[nodiscard]] bool was_rebuilt() const noexcept { return rebuilt; }     // 上一次 build 是否真的重建
+
+        // 强制下一次 build 重建 (例如经裸指针改了组件却没有 mark_changed)
+        void invalidate() noexcept { built = false; }
+
+        // 排序键：各字段都映射成 “无符号比较 = 原值比较”
+        [[nodiscard]] static uint64_t make_key(int layer, uint16_t texture_id, float depth) noexcept {
+            const uint64_t layer_bits = static_cast<uint16_t>(std::clamp(layer, -32768, 32767) + 32768);
+            uint32_t depth_bits = std::bit_cast<uint32_t>(depth);
+            depth_bits ^= (depth_bits & 0x80000000u) ? 0xFFFFFFFFu : 0x80000000u;   // IEEE 754 -> 有序整数
+            return (layer_bits << 48) | (static_cast<uint64_t>(texture_id) << 32) | depth_bits;
+        }
+
+    private:
+        static constexpr size_t RADIX = 256;
+        static constexpr size_t PASSES = sizeof(uint64_t);
+
+        std::vector<RenderItem> items;
+        std::vector<RenderItem> scratch;
+        std::vector<RenderRun> run_list;
+        size_t culled_count = 0;
+
+        bool built = false;
+        bool rebuilt = false;
+        Tick built_tick = 0;
+        CullRect built_camera;
+
+        [[nodiscard]] static bool same_rect(const CullRect& a, const CullRect& b) noexcept {
+            return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+        }
+
+        void radix_sort() {
+            if (items.size() < 2) return;
+            scratch.resize(items.size());
+
+            // 一次扫描统计全部 8 趟的直方图
+            std::array<std::array<uint32_t, RADIX>, PASSES> histograms{};
+            for (const RenderItem& item : items) {
+                for (size_t pass = 0; pass < PASSES; ++pass) {
+                    ++histograms[pass][(item.key >> (pass * 8)) & 0xFF];
+                }
+            }
+
+            for (size_t pass = 0; pass < PASSES; ++pass) {
+                auto& counts = histograms[pass];
+                const size_t shift = pass * 8;
+
+                // 本趟所有键的这个字节都相同 (常见：layer 高位、贴图 ID 高位)，顺序不变，跳过
+                if (counts[(items.front().key >> shift) & 0xFF] == items.size()) continue;
+
+                uint32_t offset = 0;
+                for (uint32_t& count : counts) {
+                    const uint32_t n = count;
+                    count = offset;
+                    offset += n;
+                }
+                for (const RenderItem& item : items) {
+                    scratch[counts[(item.key >> shift) & 0xFF]++] = item;
+                }
+                items.swap(scratch);
+            }
+        }
+
+        void build_runs() {
+            run_list.clear();
+            for (uint32_t i = 0; i < items.size(); ++i) {
+                const uint16_t texture = items[i].texture_id();
+                if (run_list.empty() || run_list.back().texture_id != texture) {
+                    run_list.push_back({ texture, i, 0 });
+                }
+                ++run_list.back().count;
+            }
+        }
+    };
+}
@@ -3,6 +3,7 @@
 #include "Core/Registry.hpp"
 #include "components/Components.hpp"
 #include "Resources/ResourceManager.hpp"
+#include "Systems/RenderQueue.hpp"
 namespace Rinn {
     // 基本结构
     class RenderSystem {
@@ -31,7 +32,15 @@ namespace Rinn {
         // === ECS 集成（核心！）===
         void render(Registry& registry, ResourceManager& rm);  // 遍历所有可渲染 Entity
 
+        // === 相机 ===
+        void set_camera(const CullRect& camera) { m_camera = camera; }
+        const CullRect& camera() const { return m_camera; }
+        const RenderQueue& queue() const { return m_queue; }    // 上一帧的排序结果 (调试 / 统计)
+
     private:
+        RenderQueue m_queue;
+        CullRect m_camera;
+
         int m_width = 0;
         int m_height = 0;
         bool m_initialized = false;
@@ -40,6 +49,7 @@ namespace Rinn {
     inline void RenderSystem::init(int width, int height, const char* title) {
         m_width = width;
         m_height = height;
+        m_camera = CullRect{ 0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height) };
         InitWindow(width, height, title);
         m_initialized = true;
     }
@@ -93,13 +103,17 @@ namespace Rinn {
         DrawText(text, (int)x, (int)y, size, color);                    // 文本
     }
 
-    // 根据渲染逻辑编写，暂时空着
+    // 先在 CPU 侧剔除 + 排序 (RenderQueue)，再按贴图连续区间提交
+    // 同一 run 内贴图不变，raylib 不会切换纹理，自动合成一批
     inline void RenderSystem::render(Registry& registry, ResourceManager& rm) {
-        // TODO: 未来按 layer 遍历
-        for (Entity entity : registry.view<Transform, Sprite>()) {
-            auto& t = registry.get<Transform>(entity);
-            auto& s = registry.get<Sprite>(entity);
-            DrawTexture(rm.get_texture(s.texture_id), t.x, t.y, WHITE);
+        m_queue.build(registry, m_camera);
+
+        const std::vector<RenderItem>& items = m_queue.sorted();
+        for (const RenderRun& run : m_queue.runs()) {
+            const Texture2D texture = rm.get_texture(run.texture_id);
+            for (uint32_t i = run.first; i < run.first + run.count; ++i) {
+                DrawTexture(texture, static_cast<int>(items[i].x - m_camera.x), static_cast<int>(items[i].y - m_camera.y), WHITE);
+            }
         }
     }
 }
@@ -0,0 +1,336 @@
+#pragma once
+#include "Core/Registry.hpp"
+#include "components/Components.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Rinn {
+
+    // =========================================================================
+    // 均匀空间哈希网格 (Spatial Hash Grid)
+    // -------------------------------------------------------------------------
+    // - 以 Transform::x/y 为左上角、Sprite::width/height 为包围盒 (无 Sprite 视为点)
+    // - 实体按包围盒中心落入一个格子；格子坐标哈希到固定数量的桶，桶内条目自带格子坐标，
+    //   哈希冲突时按坐标过滤，不会重复返回
+    // - update() 只对位置变化的实体改写条目，跨格时才在桶之间搬家 (swap-and-pop)
+    //   借助变更 tick：Transform / Sprite 池自上次同步后未被写过时整体跳过；只有 Transform 变化时只看变化的实体
+    // - 移除由事件驱动：第一次 update 时订阅该 Registry 的 on_destroy<Transform>，只删记下的实体，不扫描全部条目
+    //   没有信号的后端 (ArchetypeRegistry) 仍逐条检查；Registry 必须比网格活得久 (析构时断开订阅)
+    //   Registry::clear / load 不逐个发 destroy，之后请调用 grid.clear()
+    // - 查询结果写入调用方提供的缓冲 (清空后填充)，复用缓冲即零分配；查询是 const，可多线程并发
+    // =========================================================================
+    template<typename Traits = DefaultEntityTraits>
+    class BasicSpatialGrid {
+    public:
+        using Registry = BasicRegistry<Traits>;
+        using Entity = BasicEntity<Traits>;
+
+        // k 近邻结果：到包围盒最近点的距离平方
+        struct Neighbor {
+            Entity entity;
+            float distance_sq;
+        };
+
+        explicit BasicSpatialGrid(float cell_size = 64.0f, size_t bucket_count = 4096)
+            : cell_size(cell_size), inv_cell(1.0f / cell_size), buckets(std::bit_ceil(std::max<size_t>(bucket_count, 1))) {
+            assert(cell_size > 0.0f && "Cell size must be positive!");
+            mask = static_cast<uint32_t>(buckets.size() - 1);
+        }
+
+        // 订阅的回调捕获了 this，不能拷贝 / 移动
+        BasicSpatialGrid(const BasicSpatialGrid&) = delete;
+        BasicSpatialGrid& operator=(const BasicSpatialGrid&) = delete;
+
+        ~BasicSpatialGrid() { detach(); }
+
+        // 断开对 Registry 的订阅 (Registry 先于网格销毁时，在那之前调用)
+        void detach() {
+            if (attached != nullptr) attached->template on_destroy<Transform>().disconnect(connection);
+            attached = nullptr;
+            removed.clear();
+        }
+
+        // 与 Registry 同步：移除已销毁 / 失去 Transform 的实体，插入新实体，搬动位置变化的实体
+        // 稀疏集与 Archetype 两种后端都可以 (只要句柄类型一致)
+        template<typename Reg = Registry>
+        requires std::same_as<typename Reg::Entity, Entity>
+        void update(Reg& registry) {
+            moved = 0;
+            const Tick transform_write = registry.template storage<Transform>().last_write();
+            const Tick sprite_write = registry.template storage<Sprite>().last_write();
+            if (synced && transform_write < synced_tick && sprite_write < synced_tick) return;
+
+            // Sprite 未变时，只有 Transform 被添加 / 修改过的实体需要检查
+            auto transforms = registry.template view<const Transform>();
+            if (synced && sprite_write < synced_tick) transforms.changed_since(synced_tick);
+            synced = true;
+            synced_tick = registry.tick();
+
+            // 1. 清理失效条目
+            remove_stale(registry);
+
+            // 2. 插入 / 更新
+            transforms.each([&](Entity e, const Transform& t) {
+                const auto sprite = std::as_const(registry).template try_get<Sprite>(e);   // 只读，不标记 Sprite 修改
+                const float w = sprite ? sprite->get().width : 0.0f;
+                const float h = sprite ? sprite->get().height : 0.0f;
+
+                const size_t index = e.index();
+                if (index >= slots.size()) slots.resize(index + 1);
+                Slot& slot = slots[index];
+
+                if (slot.bucket != NONE) {
+                    Entry& entry = buckets[slot.bucket][slot.position];
+                    if (entry.min_x == t.x && entry.min_y == t.y && entry.max_x == t.x + w && entry.max_y == t.y + h) return;
+
+                    const auto [cx, cy] = cell_of(t.x + w * 0.5f, t.y + h * 0.5f);
+                    ++moved;
+                    if (cx == entry.cx && cy == entry.cy) {
+                        entry.min_x = t.x; entry.min_y = t.y;
+                        entry.max_x = t.x + w; entry.max_y = t.y + h;
+                        grow_extent(w, h);
+                        return;
+                    }
+                    erase(slot.bucket, slot.position);
+                }
+                else {
+                    ++moved;
+                }
+                insert(Entry{ e, t.x, t.y, t.x + w, t.y + h, 0, 0 });
+                });
+        }
+
+        void clear() {
+            for (std::vector<Entry>& bucket : buckets) bucket.clear();
+            slots.clear();
+            removed.clear();
+            synced = false;
+            count = 0;
+            moved = 0;
+            max_half = 0.0f;
+            min_cx = min_cy = std::numeric_limits<int32_t>::max();
+            max_cx = max_cy = std::numeric_limits<int32_t>::min();
+        }
+
+        [[nodiscard]] size_t size() const noexcept { return count; }
+        [[nodiscard]] size_t moved_last_update() const noexcept { return moved; }
+        [[nodiscard]] float cell() const noexcept { return cell_size; }
+
+        // 包围盒与 [min, max] 相交的实体 (out 可以是 std::pmr::vector，结果放进帧分配器)
+        template<typename Alloc>
+        size_t query_aabb(float min_x, float min_y, float max_x, float max_y, std::vector<Entity, Alloc>& out) const {
+            out.clear();
+            for_each_candidate(min_x, min_y, max_x, max_y, [&](const Entry& entry) {
+                if (entry.max_x >= min_x && entry.min_x <= max_x && entry.max_y >= min_y && entry.min_y <= max_y) {
+                    out.push_back(entry.entity);
+                }
+                });
+            return out.size();
+        }
+
+        // 包围盒与圆 (x, y, radius) 相交的实体
+        template<typename Alloc>
+        size_t query_radius(float x, float y, float radius, std::vector<Entity, Alloc>& out) const {
+            out.clear();
+            const float radius_sq = radius * radius;
+            for_each_candidate(x - radius, y - radius, x + radius, y + radius, [&](const Entry& entry) {
+                if (distance_sq(entry, x, y) <= radius_sq) out.push_back(entry.entity);
+                });
+            return out.size();
+        }
+
+        // 距离 (x, y) 最近的 k 个实体，按距离升序
+        // 从所在格子开始逐圈向外扩，第 k 近的距离不超过下一圈的最小可能距离时停止
+        template<typename Alloc>
+        size_t query_nearest(float x, float y, size_t k, std::vector<Neighbor, Alloc>& out) const {
+            out.clear();
+            if (k == 0 || count == 0) return 0;
+
+            constexpr auto farther = [](const Neighbor& a, const Neighbor& b) { return a.distance_sq < b.distance_sq; };
+            const auto [ccx, ccy] = cell_of(x, y);
+
+            for (int32_t ring = 0;; ++ring) {
+                const auto visit = [&](int32_t cx, int32_t cy) {
+                    for_each_in_cell(cx, cy, [&](const Entry& entry) {
+                        const float d = distance_sq(entry, x, y);
+                        if (out.size() < k) {
+                            out.push_back({ entry.entity, d });
+                            std::ranges::push_heap(out, farther);
+                        }
+                        else if (d < out.front().distance_sq) {
+                            std::ranges::pop_heap(out, farther);
+                            out.back() = { entry.entity, d };
+                            std::ranges::push_heap(out, farther);
+                        }
+                        });
+                };
+
+                if (ring == 0) {
+                    visit(ccx, ccy);
+                }
+                else {
+                    for (int32_t d = -ring; d <= ring; ++d) {
+                        visit(ccx + d, ccy - ring);
+                        visit(ccx + d, ccy + ring);
+                    }
+                    for (int32_t d = -ring + 1; d < ring; ++d) {
+                        visit(ccx - ring, ccy + d);
+                        visit(ccx + ring, ccy + d);
+                    }
+                }
+
+                // 下一圈里的实体离查询点至少 ring * cell_size - max_half
+                const float reach = static_cast<float>(ring) * cell_size - max_half;
+                if (out.size() == k && reach > 0.0f && out.front().distance_sq <= reach * reach) break;
+                // 已覆盖所有曾被占用的格子
+                if (ccx - ring <= min_cx && ccx + ring >= max_cx && ccy - ring <= min_cy && ccy + ring >= max_cy) break;
+            }
+
+            std::ranges::sort_heap(out, farther);
+            return out.size();
+        }
+
+    private:
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+        struct Entry {
+            Entity entity;
+            float min_x, min_y, max_x, max_y;
+            int32_t cx, cy;         // 所在格子 (过滤哈希冲突)
+        };
+
+        // 实体索引 -> 条目位置
+        struct Slot {
+            uint32_t bucket = NONE;
+            uint32_t position = 0;
+        };
+
+        float cell_size;
+        float inv_cell;
+        std::vector<std::vector<Entry>> buckets;
+        uint32_t mask = 0;
+        std::vector<Slot> slots;
+        size_t count = 0;
+        size_t moved = 0;
+        bool synced = false;
+        Tick synced_tick = 0;
+
+        // destroy<Transform> 订阅：上次 update 之后失去 Transform (含销毁) 的实体
+        Registry* attached = nullptr;
+        typename Registry::signal_type::Connection connection = 0;
+        std::vector<Entity> removed;
+
+        // 只增不减：查询时按最大半宽外扩格子范围；近邻搜索按占用范围终止
+        float max_half = 0.0f;
+        int32_t min_cx = std::numeric_limits<int32_t>::max(), min_cy = std::numeric_limits<int32_t>::max();
+        int32_t max_cx = std::numeric_limits<int32_t>::min(), max_cy = std::numeric_limits<int32_t>::min();
+
+        [[nodiscard]] std::pair<int32_t, int32_t> cell_of(float x, float y) const noexcept {
+            return { static_cast<int32_t>(std::floor(x * inv_cell)), static_cast<int32_t>(std::floor(y * inv_cell)) };
+        }
+
+        [[nodiscard]] uint32_t bucket_of(int32_t cx, int32_t cy) const noexcept {
+            return ((static_cast<uint32_t>(cx) * 73856093u) ^ (static_cast<uint32_t>(cy) * 19349663u)) & mask;
+        }
+
+        // 点到包围盒最近点的距离平方 (点在盒内为 0)
+        [[nodiscard]] static float distance_sq(const Entry& entry, float x, float y) noexcept {
+            const float dx = std::max({ entry.min_x - x, 0.0f, x - entry.max_x });
+            const float dy = std::max({ entry.min_y - y, 0.0f, y - entry.max_y });
+            return dx * dx + dy * dy;
+        }
+
+        void grow_extent(float w, float h) noexcept {
+            max_half = std::max({ max_half, w * 0.5f, h * 0.5f });
+        }
+
+        void insert(Entry entry) {
+            std::tie(entry.cx, entry.cy) = cell_of((entry.min_x + entry.max_x) * 0.5f, (entry.min_y + entry.max_y) * 0.5f);
+            grow_extent(entry.max_x - entry.min_x, entry.max_y - entry.min_y);
+            min_cx = std::min(min_cx, entry.cx); max_cx = std::max(max_cx, entry.cx);
+            min_cy = std::min(min_cy, entry.cy); max_cy = std::max(max_cy, entry.cy);
+
+            const uint32_t b = bucket_of(entry.cx, entry.cy);
+            slots[entry.entity.index()] = Slot{ b, static_cast<uint32_t>(buckets[b].size()) };
+            buckets[b].push_back(entry);
+            ++count;
+        }
+
+        template<typename Reg>
+        void remove_stale(Reg& registry) {
+            if constexpr (std::same_as<Reg, Registry>) {
+                if (attached == &registry) {
+                    for (Entity e : removed) erase_entity(e);
+                    removed.clear();
+                    // 漏掉的移除 (Registry::clear 之类) 会让条目比 Transform 还多：退回全量检查
+                    if (count <= registry.template storage<Transform>().size()) return;
+                }
+                else {
+                    // 第一次同步 (或换了 Registry)：先订阅，这一次全量检查
+                    detach();
+                    attached = &registry;
+                    connection = registry.template on_destroy<Transform>().connect([this](Registry&, Entity e) { removed.push_back(e); });
+                }
+            }
+
+            // 逐条检查 (倒序遍历，swap-and-pop 不影响未访问部分)
+            for (uint32_t b = 0; b < buckets.size(); ++b) {
+                for (size_t i = buckets[b].size(); i-- > 0;) {
+                    const Entity e = buckets[b][i].entity;
+                    if (!registry.is_alive(e) || !registry.template has<Transform>(e)) erase(b, static_cast<uint32_t>(i));
+                }
+            }
+        }
+
+        // 按句柄删除 (同索引的新句柄不受影响；已经不在网格里的直接忽略)
+        void erase_entity(Entity e) {
+            if (e.index() >= slots.size()) return;
+            const Slot slot = slots[e.index()];
+            if (slot.bucket != NONE && buckets[slot.bucket][slot.position].entity == e) erase(slot.bucket, slot.position);
+        }
+
+        // swap-and-pop，修正被搬动条目的 Slot
+        void erase(uint32_t b, uint32_t position) {
+            std::vector<Entry>& bucket = buckets[b];
+            slots[bucket[position].entity.index()] = Slot{};
+            if (position != bucket.size() - 1) {
+                bucket[position] = bucket.back();
+                slots[bucket[position].entity.index()].position = position;
+            }
+            bucket.pop_back();
+            --count;
+        }
+
+        template<typename Fn>
+        void for_each_in_cell(int32_t cx, int32_t cy, Fn&& fn) const {
+            for (const Entry& entry : buckets[bucket_of(cx, cy)]) {
+                if (entry.cx == cx && entry.cy == cy) fn(entry);
+            }
+        }
+
+        // 可能与 [min, max] 相交的条目：格子范围按 max_half 外扩；格子数超过桶数时直接扫全部桶
+        template<typename Fn>
+        void for_each_candidate(float min_x, float min_y, float max_x, float max_y, Fn&& fn) const {
+            const auto [x0, y0] = cell_of(min_x - max_half, min_y - max_half);
+            const auto [x1, y1] = cell_of(max_x + max_half, max_y + max_half);
+            const uint64_t cells = static_cast<uint64_t>(x1 - x0 + 1) * static_cast<uint64_t>(y1 - y0 + 1);
+
+            if (cells >= buckets.size()) {
+                for (const std::vector<Entry>& bucket : buckets) {
+                    for (const Entry& entry : bucket) fn(entry);
+                }
+                return;
+            }
+            for (int32_t cy = y0; cy <= y1; ++cy) {
+                for (int32_t cx = x0; cx <= x1; ++cx) {
+                    for_each_in_cell(cx, cy, fn);
+                }
+            }
+        }
+    };
+
+    using SpatialGrid = BasicSpatialGrid<>;
+}
@@ -1,5 +1,5 @@
 #pragma once
-#include <raylib.h>
+#include <cstdint>
 
 namespace Rinn{
     
@@ -23,5 +23,8 @@ namespace Rinn{
     struct Velocity {
         float vx, vy;
     };
+
+    // 以上组件都是行式存储：view<Transform> 可写、try_get / get 返回引用
+    // 列式 (SoA) 是按类型选用的布局 (见 Core/ColumnLayout.hpp)，不要给这里的通用组件打开，会改掉它们的整套访问方式
 }
 
@@ -1,55 +1,334 @@
 #pragma once
 #include"Types.hpp"
+#include "ComponentID.hpp"
+#include "BinaryStream.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
 
 namespace Rinn {
-	class ISparseSet {
+
+	// 分页稀疏数组：页在首次写入时才分配，未分配的页共享一张只读空页
+	// 读路径不判断页是否已分配 (未分配页读到空页)，只保留一次页表越界比较 (页表按需增长，不预占 MAX_ENTITIES)
+	// 内存占用与组件实际数量（而非 MAX_ENTITIES）成正比
+	// 页与页表都从所属池的 memory_resource 分配
+	template<typename Traits = DefaultEntityTraits>
+	class SparsePages {
 	public:
-		virtual ~ISparseSet() = default;
+		using Entity_index = typename Traits::index_type;
+		static constexpr Entity_index NULL_COMPONENT_ENTITY = Traits::NULL_INDEX;
+
+		static constexpr size_t PAGE_SIZE = 1024;		// 每页 2KB，必须是 2 的幂
+		static constexpr size_t PAGE_SHIFT = std::countr_zero(PAGE_SIZE);
+		static constexpr size_t PAGE_MASK = PAGE_SIZE - 1;
+
+		static_assert(std::has_single_bit(PAGE_SIZE), "PAGE_SIZE must be power of 2!");
+
+		using Page = std::array<Entity_index, PAGE_SIZE>;
+
+		explicit SparsePages(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: pages(resource), owned(resource) {}
+
+		SparsePages(const SparsePages&) = delete;
+		SparsePages& operator=(const SparsePages&) = delete;
+
+		~SparsePages() {
+			for (Page* page : owned) {
+				if (page != nullptr) release_page(page);
+			}
+		}
+
+		// 只读：越界页或未分配页都读到 NULL_COMPONENT_ENTITY
+		// 越界比较是唯一的分支：页表只覆盖到最高写入页，高位下标 (宽配置、GROWABLE) 不为它预留页表
+		[[nodiscard]] Entity_index get(size_t idx) const noexcept {
+			const size_t page = idx >> PAGE_SHIFT;
+			return page < pages.size() ? pages[page][idx & PAGE_MASK] : NULL_COMPONENT_ENTITY;
+		}
+
+		// 写：首次写入某页时分配该页
+		void set(size_t idx, Entity_index value) {
+			assure_page(idx >> PAGE_SHIFT)[idx & PAGE_MASK] = value;
+		}
 
-		ISparseSet() {
-			Sparse.fill(NULL_COMPONENT_ENTITY);
+		// 已分配页数（统计用）
+		[[nodiscard]] size_t page_count() const noexcept {
+			return static_cast<size_t>(std::ranges::count_if(owned, [](const auto& p) { return p != nullptr; }));
 		}
 
+		// 自有页 + 两张页表的字节数
+		[[nodiscard]] size_t bytes() const noexcept {
+			return page_count() * sizeof(Page) + pages.capacity() * sizeof(const Entity_index*) + owned.capacity() * sizeof(Page*);
+		}
+
+		// 释放已全部置空的页，截掉尾部空页，返回释放的页数 (O(已分配页 × PAGE_SIZE)，适合加载界面等空闲时机)
+		size_t shrink() {
+			size_t freed = 0;
+			for (size_t page = 0; page < owned.size(); ++page) {
+				if (owned[page] != nullptr && std::ranges::all_of(*owned[page], [](Entity_index v) { return v == NULL_COMPONENT_ENTITY; })) {
+					release_page(owned[page]);
+					owned[page] = nullptr;
+					pages[page] = NULL_PAGE.data();
+					++freed;
+				}
+			}
+			while (!owned.empty() && owned.back() == nullptr) {
+				owned.pop_back();
+				pages.pop_back();
+			}
+			owned.shrink_to_fit();
+			pages.shrink_to_fit();
+			return freed;
+		}
+
+	private:
+		// 所有空位共享的只读空页（编译期生成，无运行时初始化）
+		static constexpr Page NULL_PAGE = [] {
+			Page page{};
+			page.fill(NULL_COMPONENT_ENTITY);
+			return page;
+		}();
+
+		std::pmr::vector<const Entity_index*> pages;		// 读视图：指向自有页或 NULL_PAGE
+		std::pmr::vector<Page*> owned;					// 所有权：未分配页为 nullptr
+
+		void release_page(Page* page) noexcept {
+			page->~Page();
+			owned.get_allocator().resource()->deallocate(page, sizeof(Page), alignof(Page));
+		}
+
+		Page& assure_page(size_t page) {
+			if (page >= pages.size()) {
+				pages.resize(page + 1, NULL_PAGE.data());
+				owned.resize(page + 1);
+			}
+			if (owned[page] == nullptr) {
+				void* memory = owned.get_allocator().resource()->allocate(sizeof(Page), alignof(Page));
+				owned[page] = ::new (memory) Page(NULL_PAGE);
+				pages[page] = owned[page]->data();
+			}
+			return *owned[page];
+		}
+	};
+
+	// vector 容量收缩到 max(size, capacity)：元素搬到新缓冲区，下标不变，指针 / 引用失效
+	template<typename V>
+	void shrink_capacity(V& vec, size_t capacity) {
+		capacity = std::max(capacity, vec.size());
+		if (vec.capacity() <= capacity) return;
+		V shrunk(vec.get_allocator());
+		shrunk.reserve(capacity);
+		std::ranges::move(vec, std::back_inserter(shrunk));
+		vec.swap(shrunk);
+	}
+
+	template<typename Traits = DefaultEntityTraits>
+	class ISparseSet {
+	public:
+		using Entity = BasicEntity<Traits>;
+		using Entity_index = typename Traits::index_type;
+		static constexpr Entity_index NULL_COMPONENT_ENTITY = Traits::NULL_INDEX;
+
+		explicit ISparseSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) : Sparse(resource), sort_order(resource) {}
+		virtual ~ISparseSet() = default;
+
 		// 检查该实体是否有对应组件
 		bool has(Entity entity) const noexcept {
 			assert(!entity.is_null() && "Entity invalid");
-			return entity.index() < MAX_ENTITIES && Sparse[entity.index()] != NULL_COMPONENT_ENTITY;
+			return Sparse.get(entity.index()) != NULL_COMPONENT_ENTITY;
+		}
+		// 实体在 Dense 中的下标，没有该组件时返回 NULL_COMPONENT_ENTITY
+		[[nodiscard]] Entity_index index_of(Entity entity) const noexcept {
+			return Sparse.get(entity.index());
 		}
 		virtual void remove(Entity entity) = 0;
 		virtual void clear() = 0;
+
+		// 交换两个 Dense 槽位 (组件、实体、稀疏映射一起换)，供 Group 维护前缀使用
+		virtual void swap_dense(size_t lhs, size_t rhs) = 0;
 		virtual size_t size() const noexcept = 0;
 		
 		// ⭐ 新增：暴露底层实体数组指针，View 构造时缓存，消除遍历中的虚函数调用
 		virtual const Entity* entity_data() const noexcept = 0;
 
+		// 跟随 other 的顺序重排：两池共有的实体按 other 中的先后排到前面，其余留在后面 (相对顺序不保证)
+		// 已经一致时只有 O(other.size()) 次查表，没有交换
+		void sort_as(const ISparseSet& other) {
+			const Entity* entities = other.entity_data();
+			size_t pos = 0;
+			for (size_t i = 0; i < other.size(); ++i) {
+				const Entity_index idx = index_of(entities[i]);
+				if (idx != NULL_COMPONENT_ENTITY) swap_dense(idx, pos++);
+			}
+		}
+
+		// ---- 内存统计与收缩 (Registry::memory_stats / compact) ----
+		// 稠密部分 (组件 + 实体 + tick 平行数组) 已分配的槽位数与字节数
+		virtual size_t capacity() const noexcept = 0;
+		virtual size_t dense_bytes() const noexcept = 0;
+		// 稠密数组容量收缩到 max(size, capacity)：槽位下标、实体句柄、分组前缀都不变
+		virtual void shrink_to(size_t capacity) = 0;
+
+		[[nodiscard]] size_t sparse_pages() const noexcept { return Sparse.page_count(); }
+		[[nodiscard]] size_t sparse_bytes() const noexcept { return Sparse.bytes(); }
+		size_t shrink_sparse() { return Sparse.shrink(); }
+
+		// ---- 快照 (Registry::save / load，格式见 Snapshot.hpp) ----
+		// 跨进程稳定的组件类型标识，载入时按它匹配池
+		[[nodiscard]] virtual uint64_t type_key() const noexcept = 0;
+		// 组件平凡可复制或特化了 SnapshotTraits
+		[[nodiscard]] virtual bool serializable() const noexcept = 0;
+		// 布局记录 (BlockLayout)，然后实体、tick、组件数据按数据块写出
+		virtual void save(BinaryWriter& out) const = 0;
+		// 载入时校验池内实体的依据 (由 Registry 准备)
+		struct SnapshotCheck {
+			std::span<const Entity> live;				// 按下标排列的存活句柄，死槽位为空句柄
+			std::span<const Signature> signatures;		// 保存时的签名
+			Component_ID component = 0;					// 本池保存时的组件 ID
+
+			// 下标在水位线内、存活且版本一致、保存的签名里有本组件
+			[[nodiscard]] bool accepts(Entity entity) const noexcept {
+				return entity.index() < live.size() && live[entity.index()] == entity && signatures[entity.index()][component];
+			}
+		};
+		// 池须为空：校验布局，整块读入 count 个槽位并重建稀疏映射
+		// 布局不一致、数据不足、实体被 accept 拒绝或下标重复时返回 false，池保持为空
+		[[nodiscard]] virtual bool load(BinaryReader& in, size_t count, const SnapshotCheck& accept) = 0;
+
+		// 变更时间戳：由 Registry 推进 (不能与写组件的系统并发调用)
+		void set_tick(Tick tick) noexcept { current_tick = tick; }
+		[[nodiscard]] Tick tick() const noexcept { return current_tick; }
+
+		// 整个池最近一次被写的 tick (添加、可写访问、移除都算)；早于某 tick 说明之后整池未变
+		[[nodiscard]] Tick last_write() const noexcept { return last_write_tick.load(std::memory_order_relaxed); }
+
 	protected:
-		std::array<Entity_index, MAX_ENTITIES> Sparse;
+		// 按载入的实体数组重建稀疏映射；有实体被拒绝或下标重复时撤销已写入的映射并返回 false
+		// 先校验再写入：坏下标不会触发稀疏页分配
+		[[nodiscard]] bool restore_sparse(std::span<const Entity> entities, const SnapshotCheck& accept) {
+			for (size_t i = 0; i < entities.size(); ++i) {
+				const Entity entity = entities[i];
+				if (!accept.accepts(entity) || Sparse.get(entity.index()) != NULL_COMPONENT_ENTITY) {
+					for (size_t j = 0; j < i; ++j) Sparse.set(entities[j].index(), NULL_COMPONENT_ENTITY);
+					return false;
+				}
+				Sparse.set(entity.index(), static_cast<Entity_index>(i));
+			}
+			return true;
+		}
+
+		SparsePages<Traits> Sparse;		// 分页稀疏数组，按需分配
+		Tick current_tick = 0;
+		std::pmr::vector<Entity_index> sort_order;		// 排序用的槽位排列，跨帧复用
+
+		// 按 less(槽位a, 槽位b) 重排 Dense 槽位 (组件、实体、tick、稀疏映射一起走，与 swap_dense 相同)
+		// 先做插入排序：帧间基本有序时只有少量搬移，接近 O(n)；搬移量超过 n 说明很乱，改用 std::sort
+		// 排出排列后按置换环原地交换，每个槽位最多换一次；不是稳定排序
+		template<typename Less>
+		void sort_slots(Less less) {
+			const size_t count = size();
+			sort_order.resize(count);
+			std::iota(sort_order.begin(), sort_order.end(), Entity_index{ 0 });
+
+			size_t budget = count;
+			for (size_t i = 1; i < count; ++i) {
+				const Entity_index slot = sort_order[i];
+				size_t j = i;
+				for (; j > 0 && less(slot, sort_order[j - 1]); --j) {
+					sort_order[j] = sort_order[j - 1];
+				}
+				sort_order[j] = slot;
+				if (i - j > budget) {
+					std::sort(sort_order.begin(), sort_order.end(), less);
+					break;
+				}
+				budget -= i - j;
+			}
+
+			// sort_order[i] = 应当放到 i 的原槽位
+			for (size_t i = 0; i < count; ++i) {
+				size_t curr = i;
+				size_t next = sort_order[curr];
+				while (next != i) {
+					swap_dense(curr, next);
+					sort_order[curr] = static_cast<Entity_index>(curr);
+					curr = next;
+					next = sort_order[curr];
+				}
+				sort_order[curr] = static_cast<Entity_index>(curr);
+			}
+			sort_order.clear();
+		}
+
+		// 并行遍历中多个线程会同时标记：先读后写，同一帧内只有第一次真正写入，避免缓存行来回弹跳
+		void touch() noexcept {
+			if (last_write_tick.load(std::memory_order_relaxed) != current_tick) {
+				last_write_tick.store(current_tick, std::memory_order_relaxed);
+			}
+		}
+
+	private:
+		std::atomic<Tick> last_write_tick{ 0 };
 	};
 
 	// 具体组件类实现
-	template<typename T>
-	class SparseSet : public ISparseSet {
+	template<typename T, typename Traits = DefaultEntityTraits>
+	class SparseSet : public ISparseSet<Traits> {
 	private:
-		std::vector<T> Dense;
-		std::vector<Entity> dense_to_entity;	// 组件对应实体（完整 handle），用于 dense 反向定位 sparse 及 View 遍历
+		using Base = ISparseSet<Traits>;
+		using typename Base::Entity;
+		using typename Base::Entity_index;
+		using Base::NULL_COMPONENT_ENTITY;
+		using Base::Sparse;
+		using Base::current_tick;
+		using Base::touch;
+		using Base::sort_order;
+		using typename Base::SnapshotCheck;
+		using Base::restore_sparse;
+
+		// 全部从构造时传入的 memory_resource 分配 (默认全局堆，也可以是 StorageArena)
+		std::pmr::vector<T> Dense;
+		std::pmr::vector<Entity> dense_to_entity;	// 组件对应实体（完整 handle），用于 dense 反向定位 sparse 及 View 遍历
+
+		// 与 Dense 平行：每个槽位的添加 / 最近修改 tick，随 swap-and-pop、换位一起搬
+		std::pmr::vector<Tick> added_ticks;
+		std::pmr::vector<Tick> changed_ticks;
+
+		// 新槽位写入尾部 (与 Dense.emplace_back 配套)
+		void push_slot(Entity entity) {
+			dense_to_entity.push_back(entity);
+			added_ticks.push_back(current_tick);
+			changed_ticks.push_back(current_tick);
+			Sparse.set(entity.index(), static_cast<Entity_index>(Dense.size() - 1));
+			touch();
+		}
 	public:
 
-		// 兼容性：暴露迭代器类型，允许 std::sort 等算法工作
-		using iterator = typename std::vector<T>::iterator;
-		using const_iterator = typename std::vector<T>::const_iterator;
+		// 迭代器只遍历组件值；直接对它 std::sort 会打乱稀疏映射，重排请用 sort()
+		using iterator = typename std::pmr::vector<T>::iterator;
+		using const_iterator = typename std::pmr::vector<T>::const_iterator;
 		using value_type = T;
 
-		using ISparseSet::ISparseSet;
+		explicit SparseSet(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: Base(resource), Dense(resource), dense_to_entity(resource), added_ticks(resource), changed_ticks(resource) {}
+
+		using Base::has;
 		// 给实体挂组件--原地构造
 		template<typename... Args>
 		// 核心约束在这里：
 		requires std::constructible_from<T, Args...>
 		[[nodiscard]] T& emplace(Entity entity, Args&&... args) {
 
-			assert(entity.index() < MAX_ENTITIES && "Entity out of range!");
+			assert(entity.index() < Traits::MAX_ENTITIES && "Entity out of range!");
 
-			if (Sparse[entity.index()] != NULL_COMPONENT_ENTITY)
-				return Dense[Sparse[entity.index()]];
+			const Entity_index existing = Sparse.get(entity.index());
+			if (existing != NULL_COMPONENT_ENTITY)
+				return get(entity);
 			
 
 			// 安全：异常安全 
@@ -58,8 +337,7 @@ namespace Rinn {
 			// 一起扩容，一起成功
 			if (Dense.size() == Dense.capacity()) {
 				size_t new_cap = std::max<size_t>(Dense.capacity() * 2, 8);
-				Dense.reserve(new_cap);
-				dense_to_entity.reserve(new_cap);
+				reserve(new_cap);
 			}
 
 
@@ -68,36 +346,101 @@ namespace Rinn {
 			
 
 			//  同步稀疏集映射
-			dense_to_entity.push_back(entity);
-			Sparse[entity.index()] = static_cast<Entity_index>(Dense.size() - 1);
+			push_slot(entity);
 
 			return Dense.back();
 		}
 
+		// 预留容量：Dense 与各平行数组一起扩容 (批量插入前调用，只分配一次)
+		void reserve(size_t capacity) {
+			Dense.reserve(capacity);
+			dense_to_entity.reserve(capacity);
+			added_ticks.reserve(capacity);
+			changed_ticks.reserve(capacity);
+		}
+
+		// 再放得下 count 个：不够时至少翻倍，反复的小批量插入也是摊还 O(1)，不会每批都重新分配一次
+		void reserve_more(size_t count) {
+			const size_t needed = Dense.size() + count;
+			if (needed > Dense.capacity()) reserve(std::max(needed, Dense.capacity() * 2));
+		}
+
+		// 批量插入：先按需扩容，组件连续写入 Dense 尾部
+		// 与 emplace 一致：已有组件的实体保持原值 (要覆盖请先 remove 或直接 get 写)
+		void emplace_many(std::span<const Entity> entities, std::span<const T> values)
+		requires std::copy_constructible<T> {
+			assert(entities.size() == values.size() && "emplace_many size mismatch!");
+			reserve_more(entities.size());
+			for (size_t i : std::views::iota(size_t{ 0 }, entities.size())) {
+				const Entity entity = entities[i];
+				assert(entity.index() < Traits::MAX_ENTITIES && "Entity out of range!");
+				if (Sparse.get(entity.index()) != NULL_COMPONENT_ENTITY) continue;
+				Dense.push_back(values[i]);
+				push_slot(entity);
+			}
+		}
+
+		// 精确检查：不仅索引有组件，且存的就是这个句柄 (同索引的旧版本句柄返回 false)
+		[[nodiscard]] bool contains(Entity entity) const noexcept {
+			const Entity_index idx = Sparse.get(entity.index());
+			return idx != NULL_COMPONENT_ENTITY && dense_to_entity[idx] == entity;
+		}
+
+		// 可写访问：视为修改，记下 changed tick
 		[[nodiscard]] T& get(Entity entity) {
 			assert(has(entity) && "Entity does not have this component!");
-			return Dense[Sparse[entity.index()]];
+			const Entity_index idx = Sparse.get(entity.index());
+			changed_ticks[idx] = current_tick;
+			touch();
+			return Dense[idx];
 		}
-		// 只读get
+		// 只读get (不记录修改)
 		[[nodiscard]] const T& get(Entity entity) const {
 			assert(has(entity) && "Entity does not have this component!");
-			return Dense[Sparse[entity.index()]];
+			return Dense[Sparse.get(entity.index())];
+		}
+
+		// 显式标记修改 (经 data() 等裸指针写入后调用)
+		void mark_changed(Entity entity) noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			changed_ticks[Sparse.get(entity.index())] = current_tick;
+			touch();
+		}
+
+		// Dense 区间 [begin, end) 整体标记修改 (Group 线性遍历)
+		void mark_changed_range(size_t begin, size_t end) noexcept {
+			std::fill(changed_ticks.begin() + begin, changed_ticks.begin() + end, current_tick);
+			touch();
+		}
+
+		[[nodiscard]] Tick added_tick(Entity entity) const noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			return added_ticks[Sparse.get(entity.index())];
+		}
+
+		[[nodiscard]] Tick changed_tick(Entity entity) const noexcept {
+			assert(has(entity) && "Entity does not have this component!");
+			return changed_ticks[Sparse.get(entity.index())];
 		}
 
 		// dense_to_entity和Dense必须保持一致性：一致写，一致删
 		void remove(Entity entity) override{
-			if (entity.index() >= MAX_ENTITIES || Sparse[entity.index()] == NULL_COMPONENT_ENTITY) {
+			Entity_index index_deleted = Sparse.get(entity.index());		// 被删除实体在Dense中的索引
+			if (index_deleted == NULL_COMPONENT_ENTITY) {
 				return; // 或者 assert(false);
 			}
-			Entity_index index_deleted = Sparse[entity.index()];		// 被删除实体在Dense中的索引
 			Entity_index index_last = static_cast<Entity_index>(Dense.size() - 1);		// 队尾索引
 
 
+			touch();
+
 			// 如果删除的就是最后一个，直接 pop
 			if (index_deleted == index_last) {
 				Dense.pop_back();
 				dense_to_entity.pop_back();
-				Sparse[entity.index()] = NULL_COMPONENT_ENTITY;
+				added_ticks.pop_back();
+				changed_ticks.pop_back();
+				Sparse.set(entity.index(), NULL_COMPONENT_ENTITY);
 				return;
 			}
 
@@ -108,23 +451,54 @@ namespace Rinn {
 			// 维护稠密数组 Dense
 			Dense[index_deleted] = std::move(Dense[index_last]);
 			Dense.pop_back();
+			added_ticks[index_deleted] = added_ticks[index_last];
+			added_ticks.pop_back();
+			changed_ticks[index_deleted] = changed_ticks[index_last];
+			changed_ticks.pop_back();
 
 			// 维护稀疏数组 Sparse
-			Sparse[entity_last.index()] = index_deleted;
-			Sparse[entity.index()] = NULL_COMPONENT_ENTITY;
+			Sparse.set(entity_last.index(), index_deleted);
+			Sparse.set(entity.index(), NULL_COMPONENT_ENTITY);
 
 			// 维护dense_to_entity
 			dense_to_entity[index_deleted] = entity_last;
 			dense_to_entity.pop_back();
 		}
 
+		void swap_dense(size_t lhs, size_t rhs) override {
+			if (lhs == rhs) return;
+			using std::swap;
+			swap(Dense[lhs], Dense[rhs]);
+			swap(dense_to_entity[lhs], dense_to_entity[rhs]);
+			swap(added_ticks[lhs], added_ticks[rhs]);
+			swap(changed_ticks[lhs], changed_ticks[rhs]);
+			Sparse.set(dense_to_entity[lhs].index(), static_cast<Entity_index>(lhs));
+			Sparse.set(dense_to_entity[rhs].index(), static_cast<Entity_index>(rhs));
+		}
+
+		// 原地排序：compare 比较组件 (const T&, const T&) 或实体 (Entity, Entity)
+		// 只重排槽位，不算修改 (不更新 changed tick)；不能与遍历该池的系统并发
+		template<typename Compare>
+		void sort(Compare compare) {
+			if constexpr (std::predicate<Compare&, const T&, const T&>) {
+				this->sort_slots([this, &compare](size_t lhs, size_t rhs) { return compare(std::as_const(Dense[lhs]), std::as_const(Dense[rhs])); });
+			}
+			else {
+				static_assert(std::predicate<Compare&, Entity, Entity>, "Comparator must take (const T&, const T&) or (Entity, Entity)!");
+				this->sort_slots([this, &compare](size_t lhs, size_t rhs) { return compare(dense_to_entity[lhs], dense_to_entity[rhs]); });
+			}
+		}
+
 		// 重置 
 		void clear() override {
 			for (Entity e : dense_to_entity) {		// 从 O(Capacity) 降维到了 O(Size)
-				Sparse[e.index()] = NULL_COMPONENT_ENTITY;
+				Sparse.set(e.index(), NULL_COMPONENT_ENTITY);
 			}
 			Dense.clear();
 			dense_to_entity.clear();
+			added_ticks.clear();
+			changed_ticks.clear();
+			touch();
 		}
 
 		// 组件数
@@ -132,12 +506,81 @@ namespace Rinn {
 			return Dense.size();
 		}
 
+		[[nodiscard]] size_t capacity() const noexcept override {
+			return Dense.capacity();
+		}
+
+		[[nodiscard]] size_t dense_bytes() const noexcept override {
+			return Dense.capacity() * sizeof(T) + dense_to_entity.capacity() * sizeof(Entity)
+				+ (added_ticks.capacity() + changed_ticks.capacity()) * sizeof(Tick) + sort_order.capacity() * sizeof(Entity_index);
+		}
+
+		[[nodiscard]] uint64_t type_key() const noexcept override { return get_component_type_key<T>(); }
+		[[nodiscard]] bool serializable() const noexcept override { return snapshot_serializable<T>; }
+
+		static constexpr std::array<BlockLayout, 1> LAYOUT{ layout_of<T>() };
+
+		void save(BinaryWriter& out) const override {
+			write_layout(out, LAYOUT);
+			out.write_block(std::span<const Entity>(dense_to_entity));
+			out.write_block(std::span<const Tick>(added_ticks));
+			out.write_block(std::span<const Tick>(changed_ticks));
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				out.write_block(std::span<const T>(Dense));
+			}
+			else if constexpr (has_snapshot_traits<T>) {
+				for (const T& value : Dense) SnapshotTraits<T>::save(out, value);
+			}
+			else {
+				assert(false && "Component is neither trivially copyable nor has SnapshotTraits!");
+			}
+		}
+
+		[[nodiscard]] bool load(BinaryReader& in, size_t count, const SnapshotCheck& accept) override {
+			assert(size() == 0 && "Snapshot must be loaded into an empty pool!");
+			if (!read_layout(in, LAYOUT)) return false;
+			const std::span<const Entity> entities = in.template read_block<Entity>(count);
+			const std::span<const Tick> added = in.template read_block<Tick>(count);
+			const std::span<const Tick> changed = in.template read_block<Tick>(count);
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				const std::span<const T> values = in.template read_block<T>(count);
+				Dense.assign(values.begin(), values.end());
+			}
+			else if constexpr (has_snapshot_traits<T>) {
+				Dense.reserve(count);
+				for (size_t i = 0; i < count && in.ok(); ++i) Dense.push_back(SnapshotTraits<T>::load(in));
+			}
+			if (!in.ok() || !restore_sparse(entities, accept)) {
+				Dense.clear();
+				return false;
+			}
+
+			dense_to_entity.assign(entities.begin(), entities.end());
+			added_ticks.assign(added.begin(), added.end());
+			changed_ticks.assign(changed.begin(), changed.end());
+			touch();
+			return true;
+		}
+
+		void shrink_to(size_t capacity) override {
+			shrink_capacity(Dense, capacity);
+			shrink_capacity(dense_to_entity, capacity);
+			shrink_capacity(added_ticks, capacity);
+			shrink_capacity(changed_ticks, capacity);
+			shrink_capacity(sort_order, 0);
+		}
+
 
 		// ⭐ 新增：返回实体数组指针，供 View 缓存使用
 		[[nodiscard]] const Entity* entity_data() const noexcept override {
 			return dense_to_entity.data();
 		}
 
+		// 稠密组件数组首地址，供 Group 线性遍历
+		// 裸指针写入不记录修改，需要变更追踪时配合 mark_changed / mark_changed_range
+		[[nodiscard]] T* data() noexcept { return Dense.data(); }
+		[[nodiscard]] const T* data() const noexcept { return Dense.data(); }
+
 		// 为System准备的迭代器 
 		//  兼容性：完整的迭代器支持 Dense支持
 		iterator begin() noexcept { return Dense.begin(); }
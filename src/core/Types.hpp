@@ -10,39 +10,92 @@
 #include <concepts> // 确保构造的时候参数合法，能够造出 T
 #include <optional>		// 为了实现 “空返回”
 #include <bit>			// 为了实现快速  实体销毁组件
+#include <type_traits>	// 为了按位宽选择整数类型
+
+// 0. 实体布局配置 (Entity Traits) —— 编译期决定句柄宽度与容量
+// -------------------------------------------------------------------------
+//   Storage   : 句柄底层整数 (uint32_t / uint64_t)
+//   IndexBits : 低位索引位数，其余高位全部是 Generation
+//   Capacity  : 实体上限；超过 INLINE_ENTITY_LIMIT 时按实体索引寻址的数组改为堆上按需增长
+// -------------------------------------------------------------------------
+
+// 内联 (std::array) 存储的容量阈值：64K 实体以内数据常驻 Registry 对象本身
+constexpr size_t INLINE_ENTITY_LIMIT = 65536;
+
+// 能装下 Bits 位的最小无符号整数
+template<unsigned Bits>
+using uint_for_bits_t =
+    std::conditional_t<(Bits <= 8), std::uint8_t,
+    std::conditional_t<(Bits <= 16), std::uint16_t,
+    std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>>>;
+
+template<std::unsigned_integral Storage, unsigned IndexBits, size_t Capacity>
+struct EntityTraits {
+    using storage_type = Storage;
+    using index_type = uint_for_bits_t<IndexBits>;
+    static constexpr unsigned INDEX_BITS = IndexBits;
+    static constexpr unsigned GENERATION_BITS = sizeof(Storage) * 8 - IndexBits;
+    using generation_type = uint_for_bits_t<GENERATION_BITS>;
+
+    static constexpr storage_type INDEX_MASK = (storage_type{ 1 } << INDEX_BITS) - 1;
+    static constexpr storage_type GENERATION_MASK = std::numeric_limits<storage_type>::max() >> INDEX_BITS;
+    static constexpr storage_type NULL_ID = std::numeric_limits<storage_type>::max();
+
+    // Sparse 数组中的 “无组件” 标记，同时也是 Dense 下标类型的最大值
+    static constexpr index_type NULL_INDEX = std::numeric_limits<index_type>::max();
+
+    static constexpr size_t MAX_ENTITIES = Capacity;
+    static constexpr bool GROWABLE = Capacity > INLINE_ENTITY_LIMIT;
+
+    static_assert(IndexBits > 0 && IndexBits < sizeof(Storage) * 8, "Generation needs at least one bit!");
+    // 合法索引必须严格小于 INDEX_MASK / NULL_INDEX，保证不会与 NULL 撞车
+    static_assert(Capacity > 0 && Capacity <= INDEX_MASK && Capacity < NULL_INDEX, "Capacity exceeds index bits!");
+};
+
+// 默认布局：32 位句柄 [ Generation (16 bits) | Index (16 bits) ]，16384 实体，全部内联
+using DefaultEntityTraits = EntityTraits<std::uint32_t, 16, 16384>;
+// 宽布局：64 位句柄 [ Generation (32 bits) | Index (32 bits) ]，4M 实体，堆上按需增长
+using WideEntityTraits = EntityTraits<std::uint64_t, 32, (size_t{ 1 } << 22)>;
+
 
 // 1. 定义实体 ID
 // -------------------------------------------------------------------------
-    // 实体句柄 (Entity Handle) - 32位值类型
+    // 实体句柄 (Entity Handle) - 值类型，布局由 Traits 决定
     // -------------------------------------------------------------------------
-    // 布局：[ Generation (16 bits) | Index (16 bits) ]
+    // 默认布局：[ Generation (16 bits) | Index (16 bits) ]
     // -------------------------------------------------------------------------
-struct Entity {
-    // 唯一的成员变量：32位无符号整数
-    uint32_t id = 0;
+template<typename Traits>
+struct BasicEntity {
+    using traits_type = Traits;
+    using storage_type = typename Traits::storage_type;
+    using index_type = typename Traits::index_type;
+    using generation_type = typename Traits::generation_type;
+
+    // 唯一的成员变量：句柄整数
+    storage_type id = Traits::NULL_ID;
 
     // 掩码常量 (Compile-time constants)
-    static constexpr uint32_t INDEX_MASK = 0xFFFF;
-    static constexpr uint32_t GENERATION_SHIFT = 16;
-    static constexpr uint32_t NULL_ID = 0xFFFFFFFF;
+    static constexpr storage_type INDEX_MASK = Traits::INDEX_MASK;
+    static constexpr storage_type GENERATION_SHIFT = Traits::INDEX_BITS;
+    static constexpr storage_type NULL_ID = Traits::NULL_ID;
 
     // 默认构造：创建一个无效实体
-    constexpr Entity() : id(NULL_ID) {}
+    constexpr BasicEntity() : id(NULL_ID) {}
 
     // 内部构造：由 Registry 使用
-    constexpr Entity(uint16_t index, uint16_t generation) {
-        id = (static_cast<uint32_t>(generation) << GENERATION_SHIFT) | index;
+    constexpr BasicEntity(index_type index, generation_type generation) {
+        id = (static_cast<storage_type>(generation) << GENERATION_SHIFT) | static_cast<storage_type>(index);
     }
 
     // 1. 获取索引 (用于数组寻址) -> O(1) 位运算
     // 如果可能，请在编译期算，运行期算也可以
-    [[nodiscard]] constexpr uint16_t index() const noexcept {
-        return static_cast<uint16_t>(id & INDEX_MASK);
+    [[nodiscard]] constexpr index_type index() const noexcept {
+        return static_cast<index_type>(id & INDEX_MASK);
     }
 
     // 2. 获取版本 (用于生存检查) -> O(1) 位运算
-    [[nodiscard]] constexpr uint16_t generation() const noexcept {
-        return static_cast<uint16_t>(id >> GENERATION_SHIFT);
+    [[nodiscard]] constexpr generation_type generation() const noexcept {
+        return static_cast<generation_type>(id >> GENERATION_SHIFT);
     }
 
     // 3. 检查是否为 Null
@@ -53,7 +106,7 @@ struct Entity {
     // 4. 支持 C++20 默认比较 (==, !=)
     // 虽然使用场景不多，常用的是index和generation，但未来可能用上
     // 传值引用 比指针 引用 更快
-    friend auto operator<=>(Entity, Entity) = default;  
+    friend auto operator<=>(BasicEntity, BasicEntity) = default;  
 
     // 5. 支持作为 Map 的 Key (如果是 std::map)
     // 但我们在 ECS 里通常不用 map，而是用 sparse set
@@ -62,23 +115,79 @@ struct Entity {
 // 为了支持 std::unordered_map (如果有必要的话，尽管不推荐)
 // 还需要特化 std::hash，但暂时不需要写
 
+// 默认实体句柄 (32 位)
+using Entity = BasicEntity<DefaultEntityTraits>;
+
 
 // 2. 定义实体索引
-using Entity_index = std::uint16_t;
-using Entity_generation = std::uint16_t;
+using Entity_index = DefaultEntityTraits::index_type;
+using Entity_generation = DefaultEntityTraits::generation_type;
 
 
 // 2. 无效实体组件号 (Modern C++ 写法，检查Sparse数组中该实体有无对应组件)
-// max() 通常是 0xFFFFFFFF
-constexpr Entity_index NULL_COMPONENT_ENTITY = std::numeric_limits<Entity_index>::max();
+// max() 通常是 0xFFFF
+constexpr Entity_index NULL_COMPONENT_ENTITY = DefaultEntityTraits::NULL_INDEX;
 
 // 3. 组件 ID 类型
 using Component_ID = std::uint8_t; // 64个组件用 uint8 就够了(0-255)，省内存
 
 // 4. 数量限制（L1 cache）
-constexpr Entity_index MAX_ENTITIES = 16384;
+constexpr Entity_index MAX_ENTITIES = static_cast<Entity_index>(DefaultEntityTraits::MAX_ENTITIES);
 constexpr Component_ID MAX_COMPONENTS = 64;
 
 // 5. 签名 (Signature)
 // std::bitset<64> 占用 8 字节，非常紧凑
-using Signature = std::bitset<MAX_COMPONENTS>;
\ No newline at end of file
+using Signature = std::bitset<MAX_COMPONENTS>;
+
+// 变更时间戳 (Change Tick)
+// Registry 每帧推进一次；组件被添加 / 经可写路径访问时记下当前 tick
+// 0 表示 “比任何写入都早”，Registry 从 1 开始计数
+using Tick = std::uint32_t;
+
+
+// 6. 按实体索引寻址的数组 (Generation / Signature / 空闲环)
+// -------------------------------------------------------------------------
+// 容量 <= INLINE_ENTITY_LIMIT：std::array 内联，零堆分配（原有行为）
+// 容量 >  INLINE_ENTITY_LIMIT：std::vector 随实体水位线按需增长，未触达的部分不占内存
+// -------------------------------------------------------------------------
+template<typename T, size_t Capacity, bool Growable = (Capacity > INLINE_ENTITY_LIMIT)>
+class EntityArray {
+    std::array<T, Capacity> data{};
+public:
+    [[nodiscard]] T& operator[](size_t idx) noexcept { return data[idx]; }
+    [[nodiscard]] const T& operator[](size_t idx) const noexcept { return data[idx]; }
+
+    // 内联存储天然覆盖全部容量
+    void ensure(size_t) noexcept {}
+    void reset(const T& value) { data.fill(value); }
+    [[nodiscard]] T* raw() noexcept { return data.data(); }
+    [[nodiscard]] const T* raw() const noexcept { return data.data(); }
+    [[nodiscard]] size_t size() const noexcept { return Capacity; }
+    [[nodiscard]] size_t bytes() const noexcept { return sizeof(data); }
+};
+
+template<typename T, size_t Capacity>
+class EntityArray<T, Capacity, true> {
+    std::vector<T> data;
+public:
+    [[nodiscard]] T& operator[](size_t idx) noexcept {
+        assert(idx < data.size() && "EntityArray index beyond high-water mark!");
+        return data[idx];
+    }
+    [[nodiscard]] const T& operator[](size_t idx) const noexcept {
+        assert(idx < data.size() && "EntityArray index beyond high-water mark!");
+        return data[idx];
+    }
+
+    // 保证 [0, n) 可访问；按 2 倍增长，上限 Capacity，新增部分值初始化
+    void ensure(size_t n) {
+        if (n <= data.size()) return;
+        data.resize(std::min(Capacity, std::max(n, data.size() * 2)));
+    }
+    // 重置：释放全部内容，下次 ensure 重新值初始化
+    void reset(const T&) { data.clear(); }
+    [[nodiscard]] T* raw() noexcept { return data.data(); }
+    [[nodiscard]] const T* raw() const noexcept { return data.data(); }
+    [[nodiscard]] size_t size() const noexcept { return data.size(); }
+    [[nodiscard]] size_t bytes() const noexcept { return data.capacity() * sizeof(T); }
+};
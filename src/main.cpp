@@ -1,11 +1,15 @@
 #include <iostream>
 #include <format>
 #include "Core/Registry.hpp"
+#include "Core/Scheduler.hpp"
 #include "components/Components.hpp"
 #include <sol/sol.hpp>
 #include "Scripting/ScriptContext.hpp"
 #include "Scripting/LuaBinder.hpp"
+#include "Scripting/ResourceBinder.hpp"
 #include "Systems/RenderSystem.hpp"
+#include "Systems/SpatialGrid.hpp"
+#include "Systems/MovementSystem.hpp"
 
 // ============================================================================
 // 精灵渲染测试
@@ -15,18 +19,24 @@ int main() {
     using namespace Rinn;
 
     std::cout << "=== C++ 初始化 ===" << std::endl;
+    RINN_PROFILE_THREAD("main");
 
     // 1. 创建核心系统
-    Registry reg;
+    StorageArena storage(64u << 20);    // 组件存储预分配区 (大页对齐)，必须比 Registry 活得久
+    Registry reg(&storage);
     ResourceManager rm;
     RenderSystem renderer;
     ScriptContext ctx;
+    JobSystem jobs;
+    Scheduler scheduler(reg, jobs);
+    SpatialGrid grid(64.0f);
 
     std::cout << "核心系统创建完成" << std::endl;
 
     // 2. 绑定 Lua
     bind_registry(ctx.state(), reg);
     bind_resources(ctx.state(), rm);
+    bind_spatial(ctx.state(), grid, scheduler.frame_arena());
     std::cout << "Lua 绑定完成" << std::endl;
 
     // 3. 初始化渲染窗口
@@ -46,21 +56,48 @@ int main() {
     std::cout << "=== C++ 验证 ===" << std::endl;
     std::cout << "Registry 实体数: " << reg.size() << std::endl;
 
-    // 6. 主循环
+    // 6. 注册系统 (声明读写组件，调度器据此自动并行)
+    // 移动：拥有型分组让 Transform / Velocity 前缀对齐，顺序积分；Velocity 在分组里只读，与声明的访问一致
+    auto movers = reg.group<Transform, const Velocity>();
+    scheduler.add<Transform, const Velocity>("movement", [movers](Registry&, float dt) {
+        integrate_movement(movers, dt);
+    });
+    // 空间索引：只搬动位置变化的实体，供邻近查询 (Lua query_radius 等) 使用
+    scheduler.add<const Transform, const Sprite>("spatial", [&grid](Registry& r, float) {
+        grid.update(r);
+    });
+    // 渲染所有带 Transform + Sprite 的实体 (窗口上下文只能在主线程)
+    scheduler.add<const Transform, const Sprite>("render", [&renderer, &rm](Registry& r, float) {
+        renderer.render(r, rm);
+    }, SystemThread::Main);
+
+    // 7. 主循环
     std::cout << "=== 进入主循环 ===" << std::endl;
     while (!renderer.should_close()) {
+        RINN_PROFILE_FRAME();
         renderer.begin_frame(RAYWHITE);
         
-        // 渲染所有带 Transform + Sprite 的实体
-        renderer.render(reg, rm);
+        scheduler.run(renderer.delta_time());
         
         // 显示 FPS
         renderer.draw_text(std::format("FPS: {}", renderer.fps()).c_str(), 10, 10, 20, DARKGRAY);
         
         renderer.end_frame();
+
+#ifdef RINN_PROFILE
+        // F9：导出最近的分析记录 (chrome://tracing 或 Perfetto 打开)
+        if (IsKeyPressed(KEY_F9) && Profiler::instance().write_chrome_trace("rinn_trace.json")) {
+            std::cout << "已导出 rinn_trace.json" << std::endl;
+        }
+#endif
     }
 
-    // 7. 清理
+#ifdef RINN_PROFILE
+    Profiler::instance().print_summary();
+    (void)Profiler::instance().write_chrome_trace("rinn_trace.json");
+#endif
+
+    // 8. 清理
     renderer.shutdown();
     std::cout << "=== 程序结束 ===" << std::endl;
     return 0;